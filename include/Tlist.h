@@ -2,6 +2,8 @@
 #define T_LIST
 
 #include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @enum Type
@@ -12,9 +14,32 @@ typedef enum Type{
     INT,    /**< Integer type. The list stores a copy of the value. */
     STRING, /**< C-string type (char*). The list stores a copy of the string. */
     FLOAT,  /**< Float type. The list stores a copy of the value. */
-    DOUBLE  /**< Double type. The list stores a copy of the value. */
+    DOUBLE, /**< Double type. The list stores a copy of the value. */
+    RECORD, /**< Fixed-size plain data, passed by pointer and stored by value. See `newRecordList`. */
+    INT8,   /**< `int8_t`, passed as `int`. */
+    INT16,  /**< `int16_t`, passed as `int`. */
+    INT32,  /**< `int32_t`. */
+    INT64,  /**< `int64_t`. Pass values of exactly this type, e.g. `(int64_t)1`. */
+    UINT8,  /**< `uint8_t`, passed as `int`. */
+    UINT16, /**< `uint16_t`, passed as `int`. */
+    UINT32, /**< `uint32_t`. */
+    UINT64  /**< `uint64_t`. Pass values of exactly this type, e.g. `(uint64_t)1`. */
 } Type;
 
+/**
+ * @enum Layout
+ * @brief Storage layouts a list can be created with. See `newListOf`.
+ */
+typedef enum Layout{
+    LINKED,   /**< Singly linked list with one node per element (default). */
+    UNROLLED, /**< Linked list of chunks, each holding a small array of elements. */
+    ARRAY,    /**< Growable contiguous array of elements. */
+    INDEXED,  /**< Linked list of nodes in one pool array, linked by 32-bit indices. */
+    DOUBLY,   /**< Doubly linked list with one XOR link per node. */
+    SKIPLIST, /**< Indexable skip list with O(log n) positional access. */
+    ROPE      /**< Balanced tree of chunks with O(log n) positional access. */
+} Layout;
+
 /**
  * @brief Opaque pointer to the list structure.
  */
@@ -29,6 +54,177 @@ typedef struct Node *Node;
  * @brief Opaque pointer to the iterator structure.
  */
 typedef struct TIterator* TIterator;
+typedef struct ListSlice* ListSlice;
+
+/**
+ * @struct ListLink
+ * @brief Link field for elements of an intrusive `T` list.
+ *
+ * Embed one in your own struct and pass its offset to `enableIntrusive`; the
+ * list then chains your structs through it instead of allocating nodes.
+ * The link is aligned like list nodes, for any type, which may add padding
+ * before it in your struct. The fields are private.
+ */
+typedef struct ListLink{
+    _Alignas(max_align_t) void *_val;  /**< The element the link is embedded in. */
+    struct ListLink *_next;            /**< The next link in the list. */
+} ListLink;
+
+/**
+ * @struct ListArena
+ * @brief A bump arena over caller-supplied memory that lists can allocate from.
+ *
+ * Lists created with `newListIn` take their struct, nodes, chunks, buffers and
+ * strings from the arena and never give memory back. Dropping them all is a
+ * single `resetListArena`. The fields are private.
+ */
+typedef struct ListArena{
+    unsigned char *_buffer;   /**< The caller's memory. */
+    size_t _capacity;         /**< Size of `_buffer` in bytes. */
+    size_t _used;             /**< Bytes handed out so far. */
+} ListArena;
+
+/**
+ * @struct ListAllocator
+ * @brief Memory allocation hooks for a list.
+ *
+ * Each hook receives `context` as its first argument and otherwise behaves like
+ * its C library counterpart. Pass one to `newListWith` to route a list's
+ * allocations through your own allocator.
+ */
+typedef struct ListAllocator{
+    void *(*malloc)(void *context, size_t size);             /**< Allocates `size` bytes, or returns NULL. */
+    void *(*realloc)(void *context, void *ptr, size_t size); /**< Resizes a block, or returns NULL keeping it. */
+    void (*free)(void *context, void *ptr);                  /**< Releases a block. */
+    void *context;                                           /**< Passed to every hook. */
+} ListAllocator;
+
+/**
+ * @brief A compact list header. See `struct ListHeader`.
+ */
+typedef struct ListHeader ListHeader;
+
+/** @private Sorting options, defined privately. */
+struct SortPlan;
+
+/** @private Search options, defined privately. */
+struct SearchPlan;
+
+/**
+ * @struct ListOps
+ * @brief Operations table shared by every list of the same layout.
+ *
+ * A `ListHeader` points to one of these instead of carrying its own function
+ * pointers. The methods behave exactly like their `struct Lista` counterparts,
+ * except that they invalidate slices only when they change the list's length.
+ */
+struct ListOps{
+    /** @brief Adds an element to the end of the list. */
+    void (*push)(ListHeader *this, ...);
+    /** @brief Removes and returns the first element of the list. */
+    void *(*pop)(ListHeader *this);
+    /** @brief Prints the list contents to stdout. */
+    void (*print)(ListHeader *this);
+    /** @brief Returns the number of elements in the list. */
+    int (*len)(ListHeader *this);
+    /** @brief Frees all nodes and their contained data. Does not free the header itself. */
+    void (*free)(ListHeader *this);
+    /** @brief Returns a pointer to the element at the specified index without removing it. */
+    void *(*get)(ListHeader *this, int index);
+    /** @brief Updates the element at a specific index. */
+    void (*set)(ListHeader *this, int index, ...);
+    /** @brief Removes the element at a specific index. */
+    void (*remove)(ListHeader *this, int index);
+    /** @brief Inserts an element at a specific index. */
+    void (*insert)(ListHeader *this, int index, ...);
+    /** @brief Removes and returns the element at a specific index. */
+    void *(*pick)(ListHeader *this, int index);
+    /** @brief Applies a function to each element of the list. */
+    void (*foreach)(ListHeader *this, void(*function)(void* data));
+    /** @brief Removes and returns the last element of the list. */
+    void *(*popBack)(ListHeader *this);
+
+    /* Layout primitives behind the variadic methods; internal. */
+    void (*_pushValue)(ListHeader *this, void *val);
+    void (*_setValue)(ListHeader *this, int index, void *val);
+    void (*_insertValue)(ListHeader *this, int index, void *val);
+    void (*_pushValues)(ListHeader *this, const unsigned char *src, size_t n);
+    void (*_concat)(ListHeader *this, ListHeader *src);
+    void (*_splitAt)(ListHeader *this, int index, ListHeader *suffix);
+    void (*_sort)(ListHeader *this, const struct SortPlan *plan);
+    int (*_find)(ListHeader *this, const struct SearchPlan *plan);
+};
+
+/**
+ * @struct ListHeader
+ * @brief The state of a list, with a pointer to its layout's shared operations.
+ *
+ * A header can live anywhere the caller likes (on the stack, in an array,
+ * embedded in another struct) and needs no allocation of its own. It holds the
+ * layout's state only: options such as a string arena, a node pool or a hash
+ * index keep theirs in a separate extension, allocated when first enabled.
+ * Set it up with `initListHeader`, call its methods through `ops`, and release
+ * its contents with `destroyListHeader`. The functions taking a `List` have a
+ * `ListHeader` variant named after them, such as `sortHeader`, `concatHeaders`
+ * and `newIteratorHeader`:
+ *
+ * ```c
+ * ListHeader h;
+ * initListHeader(&h, INT, LINKED);
+ * h.ops->push(&h, 10);
+ * destroyListHeader(&h);
+ * ```
+ *
+ * Fields starting with an underscore are private.
+ */
+struct ListHeader{
+    const struct ListOps *ops;  /**< Operations of the list's layout. */
+    Type _type;                 /**< The data type of the elements stored in the list. */
+    Layout _layout;             /**< The storage layout chosen at creation. */
+    size_t _size;               /**< The size in bytes of the data type stored (for value types). */
+    int _length;                /**< The number of elements in the list. */
+    unsigned int _version;      /**< Bumped by every change that adds, removes or moves elements; checked by slices. */
+    struct ListExtras *_extras; /**< State of opt-in features, allocated the first time one needs it. */
+
+    /* Layout state */
+    union {
+        struct {                       /* LINKED */
+            Node _head;                /**< Pointer to the first node in the list. */
+            Node _tail;                /**< Pointer to the last node in the list. */
+            Node _cursor;              /**< Last node reached by a positional operation, or NULL. */
+            int _cursorIndex;          /**< Index of `_cursor`. */
+        };
+        struct {                       /* UNROLLED */
+            struct Chunk *_firstChunk; /**< First chunk of elements. */
+            struct Chunk *_lastChunk;  /**< Last chunk of elements. */
+            int _chunkCapacity;        /**< Number of elements a chunk can hold. */
+        };
+        struct {                       /* ARRAY */
+            unsigned char *_items;     /**< Element buffer. */
+            int _offset;               /**< Index in `_items` of the first element; advanced by `pop`. */
+            int _capacity;             /**< Number of elements `_items` can hold. */
+        };
+        struct {                       /* INDEXED */
+            uint32_t *_links;          /**< Successor of each pool node. */
+            unsigned char *_values;    /**< Value of each pool node, `_size` bytes apart. */
+            uint32_t _first;           /**< First node of the list. */
+            uint32_t _last;            /**< Last node of the list. */
+            uint32_t _vacant;          /**< Released nodes, chained through `_links`. */
+            uint32_t _slots;           /**< Number of nodes the pool can hold. */
+            uint32_t _carved;          /**< Nodes handed out at least once. */
+        };
+        struct {                       /* SKIPLIST */
+            struct SkipNode *_skipHead;  /**< Sentinel holding the first link of every level, allocated on first insertion. */
+            int _skipLevel;            /**< Number of levels in use. */
+            unsigned int _skipSeed;    /**< State of the node height generator. */
+        };
+        struct {                       /* ROPE */
+            struct RopeNode *_ropeRoot;  /**< Root of the tree of chunks. */
+            int _ropeCapacity;         /**< Maximum number of elements per chunk. */
+            unsigned int _ropeSeed;    /**< State of the chunk priority generator. */
+        };
+    };
+};
 
 /**
  * @struct Lista
@@ -37,14 +233,12 @@ typedef struct TIterator* TIterator;
  * This structure encapsulates the state of the list and provides function
  * pointers that act as methods for list manipulation. It's designed to be
  * an opaque type to the user, who should interact with it via the `List` pointer.
+ *
+ * The state is a `ListHeader`; the per-instance methods forward to its shared
+ * operations table. Use a bare `ListHeader` when the method pointers are not wanted.
  */
 struct Lista{
-    /* List state */
-    Node _head;      /**< Pointer to the first node in the list. */
-    Node _tail;      /**< Pointer to the last node in the list. */
-    Type _type;      /**< The data type of the elements stored in the list. */
-    size_t _size;    /**< The size in bytes of the data type stored (for value types). */
-    int _length;     /**< The number of elements in the list. */
+    ListHeader _header;  /**< List state. Must stay the first member. */
 
     /* Methods */
     /** @brief Adds an element to the end of the list. */
@@ -69,6 +263,8 @@ struct Lista{
     void *(*pick)(List this, int index);
     /** @brief Applies a function to each element of the list. */
     void (*foreach)(List this, void(*function)(void* data));
+    /** @brief Removes and returns the last element of the list. O(1) for `DOUBLY` and `ARRAY` lists. */
+    void *(*popBack)(List this);
 };
 
 /**
@@ -83,6 +279,562 @@ struct Lista{
  */
 List newList(Type type);
 
+/**
+ * @brief Creates a new empty list of fixed-size records stored by value.
+ *
+ * `push`, `set` and `insert` take a pointer to a record and copy its
+ * `recordSize` bytes into the list, inline in the node, chunk or buffer, so no
+ * allocation of the caller's is needed. `get` returns a pointer to the stored
+ * copy; `pop` and `pick` return a `malloc` copy, as for the other value types.
+ *
+ * ```c
+ * struct Sample { double time; float value; int sensor; };
+ * List samples = newRecordList(sizeof(struct Sample), ARRAY);
+ * samples->push(samples, &(struct Sample){ 0.5, 21.0f, 3 });
+ * ```
+ *
+ * Records are copied with `memcpy` and must not need deep copying. The list
+ * constructors that take no record size reject `RECORD`; `newRecordListIn`,
+ * `newRecordListWith`, `initRecordList` and `initRecordListHeader` are their
+ * record counterparts.
+ * @param recordSize The size of a record in bytes, typically `sizeof` the struct.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return A pointer to the newly created list, or NULL if `recordSize` is zero.
+ */
+List newRecordList(size_t recordSize, Layout layout);
+
+/**
+ * @brief Creates a new empty list with a specific storage layout.
+ *
+ * All layouts expose the same methods with the same semantics; they differ
+ * only in performance. `newList(type)` is equivalent to `newListOf(type, LINKED)`.
+ *
+ * - `LINKED`: one node per element. Cheapest insertion and removal at a known position.
+ * - `UNROLLED`: each node is a chunk holding up to 256 bytes of elements plus a count.
+ *   Traversal touches far fewer cache lines, and insertion only shifts one chunk.
+ * - `ARRAY`: a single growable buffer. `get` and `set` are O(1), `push` and `pop` are
+ *   amortized O(1), and `insert`/`remove` shift the elements after the index.
+ * - `INDEXED`: like `LINKED`, but the nodes live in one growable pool and link by
+ *   32-bit indices, with values inline. An `INT` element takes 8 bytes.
+ * - `DOUBLY`: like `LINKED`, with no extra memory per node, but walkable from both
+ *   ends: `popBack` is O(1), positional access starts from the nearer end, and
+ *   `newReverseIterator` iterates from the tail.
+ * - `SKIPLIST`: an indexable skip list. `get`, `set`, `insert`, `remove` and `pick`
+ *   are O(log n) at any index; `push` is O(log n) and iteration is a linked walk.
+ * - `ROPE`: a balanced tree of chunks of contiguous elements. Positional operations
+ *   are O(log n) at any index while scans stay within chunks, for very large lists.
+ *
+ * @param type The data type the list will hold. See the `Type` enum. `RECORD`
+ *        lists are created with `newRecordList`.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return A pointer to the newly created list, or NULL for `RECORD`.
+ */
+List newListOf(Type type, Layout layout);
+
+/**
+ * @brief Prepares a bump arena over `capacity` bytes of caller memory.
+ *
+ * The arena does not own `buffer`; it only hands out pieces of it.
+ * @param arena The arena to initialize.
+ * @param buffer The memory to allocate from.
+ * @param capacity Size of `buffer` in bytes.
+ */
+void initListArena(ListArena *arena, void *buffer, size_t capacity);
+
+/**
+ * @brief Discards everything allocated from an arena at once.
+ *
+ * Every list created in the arena becomes invalid, without any of them being
+ * walked or freed. Values returned by `pop` and `pick` are ordinary `malloc`
+ * blocks and survive the reset.
+ * @param arena The arena to reset.
+ */
+void resetListArena(ListArena *arena);
+
+/**
+ * @brief Creates a new empty list whose memory all comes from a bump arena.
+ *
+ * Works like `newListOf`, but the `struct Lista`, its nodes, chunks or buffer,
+ * and its string copies are carved from `arena`. There is no need to call the
+ * list's `free` method or `free()` on it: `resetListArena` releases everything.
+ * Removing elements does not return memory to the arena.
+ *
+ * @param arena The arena to allocate from. Must outlive the list.
+ * @param type The data type the list will hold. See the `Type` enum. `RECORD`
+ *        lists are created with `newRecordListIn`.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return A pointer to the newly created list, or NULL for `RECORD`.
+ * @warning The program exits with `EXIT_FAILURE` when the arena runs out of space.
+ */
+List newListIn(ListArena *arena, Type type, Layout layout);
+
+/**
+ * @brief Creates a new empty list of fixed-size records in a bump arena.
+ *
+ * Works like `newListIn` for a list created like `newRecordList`.
+ * @param arena The arena to allocate from. Must outlive the list.
+ * @param recordSize The size of a record in bytes, typically `sizeof` the struct.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return A pointer to the newly created list, or NULL if `recordSize` is zero.
+ * @warning The program exits with `EXIT_FAILURE` when the arena runs out of space.
+ */
+List newRecordListIn(ListArena *arena, size_t recordSize, Layout layout);
+
+/**
+ * @brief Creates a new empty list that allocates through the given hooks.
+ *
+ * Works like `newListOf`, but the `struct Lista`, its nodes, chunks or buffer,
+ * its string copies and its iterators are all allocated with `allocator`.
+ * After the list's `free` method, release the list itself with
+ * `allocator->free(allocator->context, list)` instead of `free()`.
+ * Values returned by `pop` and `pick` still come from `malloc`, so they are
+ * released with `free()` as for any other list.
+ *
+ * @param type The data type the list will hold. See the `Type` enum. `RECORD`
+ *        lists are created with `newRecordListWith`.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @param allocator The allocation hooks, or NULL for the C library. Must outlive the list.
+ * @return A pointer to the newly created list, or NULL for `RECORD`.
+ */
+List newListWith(Type type, Layout layout, const ListAllocator *allocator);
+
+/**
+ * @brief Creates a new empty list of fixed-size records that allocates through the given hooks.
+ *
+ * Works like `newListWith` for a list created like `newRecordList`.
+ * @param recordSize The size of a record in bytes, typically `sizeof` the struct.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @param allocator The allocation hooks, or NULL for the C library. Must outlive the list.
+ * @return A pointer to the newly created list, or NULL if `recordSize` is zero.
+ */
+List newRecordListWith(size_t recordSize, Layout layout, const ListAllocator *allocator);
+
+/**
+ * @brief Initializes a list in caller-provided storage.
+ *
+ * Works like `newListOf` without allocating the `struct Lista` itself. Release the
+ * list's contents with `list->free(list)`; the storage stays the caller's.
+ *
+ * @param list The storage to initialize.
+ * @param type The data type the list will hold. See the `Type` enum. `RECORD`
+ *        lists are initialized with `initRecordList`.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return true on success, false for `RECORD`, leaving `list` untouched.
+ */
+bool initList(struct Lista *list, Type type, Layout layout);
+
+/**
+ * @brief Initializes a list of fixed-size records in caller-provided storage.
+ *
+ * Works like `newRecordList` without allocating the `struct Lista` itself.
+ * @param list The storage to initialize.
+ * @param recordSize The size of a record in bytes, typically `sizeof` the struct.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return true on success, false if `recordSize` is zero, leaving `list` untouched.
+ */
+bool initRecordList(struct Lista *list, size_t recordSize, Layout layout);
+
+/**
+ * @brief Initializes a compact list header in caller-provided storage.
+ *
+ * The header carries the list state plus one pointer to an operations table
+ * shared by all lists of the same layout, instead of eleven method pointers.
+ *
+ * @param header The storage to initialize.
+ * @param type The data type the list will hold. See the `Type` enum. `RECORD`
+ *        headers are initialized with `initRecordListHeader`.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return true on success, false for `RECORD`, leaving `header` untouched.
+ */
+bool initListHeader(ListHeader *header, Type type, Layout layout);
+
+/**
+ * @brief Initializes a compact header for a list of fixed-size records.
+ *
+ * Works like `initListHeader` for a list created like `newRecordList`.
+ * @param header The storage to initialize.
+ * @param recordSize The size of a record in bytes, typically `sizeof` the struct.
+ * @param layout The storage layout. See the `Layout` enum.
+ * @return true on success, false if `recordSize` is zero, leaving `header` untouched.
+ */
+bool initRecordListHeader(ListHeader *header, size_t recordSize, Layout layout);
+
+/**
+ * @brief Releases everything a list header owns, leaving it empty.
+ *
+ * The header itself is not freed; it can be reused or discarded.
+ * @param header The header to clear.
+ */
+void destroyListHeader(ListHeader *header);
+
+/**
+ * @brief Attaches a node pool to an empty list.
+ *
+ * Once enabled, nodes are carved from slabs of `nodesPerSlab` nodes instead of
+ * being allocated one by one, and nodes released by `remove`, `pick` and `pop`
+ * are reused by later insertions. The list's `free` method releases whole slabs
+ * at once; for `INT`, `FLOAT`, `DOUBLE` and `T` lists it no longer walks the chain.
+ * It also turns the pool off, like every other option.
+ *
+ * @param list The list to configure. Must be empty.
+ * @param nodesPerSlab Number of nodes per slab, or 0 for a default of 1024.
+ */
+void enableNodePool(List list, size_t nodesPerSlab);
+
+/**
+ * @brief Attaches a node pool to an empty list header, like `enableNodePool`.
+ * @param header The header to configure. Must be empty.
+ * @param nodesPerSlab Number of nodes per slab, or 0 for a default of 1024.
+ */
+void enableNodePoolHeader(ListHeader *header, size_t nodesPerSlab);
+
+/**
+ * @brief Makes an empty `T` list link its elements through an embedded `ListLink`.
+ *
+ * Every element pushed or inserted afterwards must be a pointer to a struct with
+ * a `ListLink` at `linkOffset` bytes, and that link is used as the element's node:
+ * `push`, `insert`, `remove`, `pop` and `pick` no longer allocate or free anything.
+ * An element can be in only one intrusive list at a time per embedded link.
+ * The list's `free` method forgets the elements and turns intrusive mode off.
+ *
+ * ```c
+ * struct Request { int id; ListLink link; };
+ * List queue = newList(T);
+ * enableIntrusive(queue, offsetof(struct Request, link));
+ * queue->push(queue, &request);
+ * ```
+ *
+ * @param list The list to configure. Must be an empty `LINKED` list of type `T` without a node pool.
+ * @param linkOffset Offset of the `ListLink` inside the element struct.
+ */
+void enableIntrusive(List list, size_t linkOffset);
+
+/**
+ * @brief Makes an empty `T` list header intrusive, like `enableIntrusive`.
+ * @param header The header to configure. Must be an empty `LINKED` header of type `T` without a node pool.
+ * @param linkOffset Offset of the `ListLink` inside the element struct.
+ */
+void enableIntrusiveHeader(ListHeader *header, size_t linkOffset);
+
+/**
+ * @brief Stores the strings of an empty `STRING` list in a per-list arena.
+ *
+ * String bytes are packed into large blocks owned by the list instead of one
+ * allocation per element, and the list's `free` method drops the blocks at once.
+ * With `intern` set, equal strings are stored once and shared by all the
+ * elements holding them.
+ *
+ * Arena strings are only reclaimed by `free`, which also turns the arena off:
+ * replacing or removing an element leaves its bytes in the arena. `pop` and `pick` return a `malloc` copy, so
+ * their result is still released with `free()`.
+ *
+ * @param list The list to configure. Must be an empty `STRING` list.
+ * @param intern Whether to deduplicate equal strings.
+ */
+void enableStringArena(List list, bool intern);
+
+/**
+ * @brief Stores the strings of an empty `STRING` list header in an arena, like `enableStringArena`.
+ * @param header The header to configure. Must be an empty `STRING` header.
+ * @param intern Whether to deduplicate equal strings.
+ */
+void enableStringArenaHeader(ListHeader *header, bool intern);
+
+/**
+ * @brief Keeps a hash index of the list's values, for O(1) `contains` and `count`.
+ *
+ * From then on `push`, `insert`, `set`, `remove`, `pick`, `pop`, `popBack`,
+ * `pushArray`, `concat` and `splitAt` keep a hash table counting the elements
+ * equal to each value up to date, which costs a hash and a probe per element
+ * added or removed. Values hash and compare as in `indexOf`; `STRING` and
+ * `RECORD` keys are copied into the index. `contains` and `count` then answer
+ * from the table, and `indexOf` and `lastIndexOf` return -1 at once for an
+ * absent value, but scan for the position of a present one. `concat` and
+ * `splitAt` move the elements of indexed lists one by one.
+ *
+ * The index can be enabled at any time and indexes the current elements.
+ * Changing an element in place, through a pointer from `get`, `foreach` or an
+ * iterator, bypasses the index. `free` drops the index and turns it off.
+ * @param list A pointer to the list.
+ */
+void enableHashIndex(List list);
+
+/**
+ * @brief Keeps a hash index of a list header's values, like `enableHashIndex`.
+ *
+ * The header's `ops` switch to an indexing table, so read `ops` through the
+ * header each time rather than keeping a copy.
+ * @param header A pointer to the header.
+ */
+void enableHashIndexHeader(ListHeader *header);
+
+/**
+ * @brief Appends `n` values from a C array to the end of the list in one call.
+ *
+ * `src` holds the values as the list stores them: an `int[]` for `INT`, a
+ * `double[]` for `DOUBLE`, an `int64_t[]` for `INT64`, back-to-back records for
+ * `RECORD`, a `char *[]` for `STRING` (each string is copied) and a `void *[]`
+ * for `T`. `ARRAY` and `UNROLLED` lists reserve room once and copy value types
+ * in bulk; the other layouts append element by element, without the variadic
+ * call of `push`.
+ * @param list The list to append to.
+ * @param src The array of values.
+ * @param n Number of values in `src`.
+ */
+void pushArray(List list, const void *src, size_t n);
+
+/**
+ * @brief Appends `n` values from a C array to a list header, like `pushArray`.
+ * @param header The header to append to.
+ * @param src The array of values.
+ * @param n Number of values in `src`.
+ */
+void pushArrayHeader(ListHeader *header, const void *src, size_t n);
+
+/**
+ * @brief Copies the values of the list, in order, into a C array.
+ *
+ * `dst` receives the values in the format `pushArray` reads them. For `STRING`
+ * and `T` lists the pointers are copied: the strings remain owned by the list.
+ * @param list The list to read.
+ * @param dst The array to fill.
+ * @param n Capacity of `dst`, in elements.
+ * @return The number of values copied: the smaller of `n` and the list's length.
+ */
+size_t toArray(List list, void *dst, size_t n);
+
+/**
+ * @brief Copies the values of a list header into a C array, like `toArray`.
+ * @param header The header to read.
+ * @param dst The array to fill.
+ * @param n Capacity of `dst`, in elements.
+ * @return The number of values copied: the smaller of `n` and the list's length.
+ */
+size_t toArrayHeader(ListHeader *header, void *dst, size_t n);
+
+/**
+ * @brief Moves every element of `src` to the end of `dst`, leaving `src` empty.
+ *
+ * When both lists have the same layout and draw memory from the same place,
+ * nodes and chunks are relinked instead of copied: O(1) for `LINKED`, `DOUBLY`
+ * and `UNROLLED`, O(log n) for `ROPE`, and one `memcpy` of the slots for `ARRAY`.
+ * Otherwise, and for `INDEXED` and `SKIPLIST` lists, or when either list uses a
+ * node pool or a string arena, the elements are moved one by one.
+ *
+ * Pointers returned by `get` on `src` stay valid for relinked nodes and chunks.
+ * @param dst The list to append to.
+ * @param src The list to empty. Must hold the same type as `dst`.
+ */
+void concat(List dst, List src);
+
+/**
+ * @brief Moves every element of `src` to the end of `dst`, like `concat`.
+ * @param dst The header to append to.
+ * @param src The header to empty. Must hold the same type as `dst`.
+ */
+void concatHeaders(ListHeader *dst, ListHeader *src);
+
+/**
+ * @brief Detaches the elements from `index` onwards into a new list.
+ *
+ * The new list has the type and layout of `list`, and its memory comes from the
+ * same arena or allocator; release it the same way as `list`. Nodes and chunks
+ * are relinked where `concat` would relink them, after an O(index) walk for
+ * `LINKED` lists, from the nearer end for `DOUBLY`, and in O(log n) for `ROPE`.
+ * @param list The list to split.
+ * @param index The index of the first element to move, from 0 to the list's length.
+ * @return A new list holding the moved elements, or NULL if `index` is out of bounds.
+ */
+List splitAt(List list, int index);
+
+/**
+ * @brief Detaches the elements from `index` onwards into a caller-provided header, like `splitAt`.
+ *
+ * `suffix` is initialized with the type, layout and options of `header`, and
+ * released with `destroyListHeader`. Lists drawing memory from an arena or an
+ * allocator cannot be split into a bare header; use `splitAt` for them.
+ * @param header The header to split.
+ * @param index The index of the first element to move, from 0 to the list's length.
+ * @param suffix The storage for the moved elements. Its previous contents are overwritten.
+ * @return true on success, false if `index` is out of bounds or the list cannot be split this way.
+ */
+bool splitAtHeader(ListHeader *header, int index, ListHeader *suffix);
+
+/**
+ * @brief Sorts the list in ascending order. The sort is stable.
+ *
+ * Without a comparator, numbers compare by value and `STRING` elements with
+ * `strcmp`, through code specialized for each type. `compare` overrides that
+ * order and is required for `T` and `RECORD` lists; like a `qsort` comparator
+ * it returns a negative, zero or positive number, but its arguments are the
+ * element pointers `get` would return: the stored pointer for `T`, the string
+ * for `STRING`, and a pointer to the value otherwise. It must be a consistent
+ * order, or the result is unspecified.
+ *
+ * In the built-in order of `FLOAT` and `DOUBLE`, -0.0 and 0.0 are equal and
+ * NaNs sort to the ends by their sign: negative NaNs first, the others last.
+ *
+ * `LINKED` and `DOUBLY` lists are sorted by relinking their nodes, with no
+ * allocation, so pointers returned by `get` keep pointing at the same values.
+ * The other layouts move the values between their slots through one scratch
+ * buffer (two when the elements are not already contiguous).
+ * @param list The list to sort.
+ * @param compare The comparator, or NULL for the natural order of the type.
+ */
+void sort(List list, int (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Sorts a list header, like `sort`.
+ * @param header The header to sort.
+ * @param compare The comparator, or NULL for the natural order of the type.
+ */
+void sortHeader(ListHeader *header, int (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Sorts a numeric list in ascending order with an LSD radix sort. The sort is stable.
+ *
+ * Runs in O(n) per key byte instead of O(n log n) comparisons: each value is
+ * mapped to an unsigned key with the same order, by flipping the sign bit of
+ * signed integers and, for `FLOAT` and `DOUBLE`, flipping the sign bit of
+ * positive values and every bit of negative ones. Bytes that are equal in every
+ * key are skipped, so small ranges take fewer passes.
+ *
+ * The order matches `sort`, NaNs at the ends by their sign included, except
+ * that -0.0 sorts before +0.0 and NaNs of one sign are ordered by their bits
+ * rather than kept in list order. `LINKED` and `DOUBLY` lists sort an array of
+ * key/node pairs and relink their nodes in that order; the other layouts use
+ * the same buffers as `sort`.
+ * @param list The list to sort. Must hold one of the numeric types.
+ */
+void radixSort(List list);
+
+/**
+ * @brief Radix sorts a numeric list header, like `radixSort`.
+ * @param header The header to sort. Must hold one of the numeric types.
+ */
+void radixSortHeader(ListHeader *header);
+
+/**
+ * @brief Sorts the list like `sort`, on up to `threads` threads.
+ *
+ * The elements are cut into one run per thread, the runs are sorted at once,
+ * then merged pairwise in rounds, the merges of each round running at once.
+ * Slot arrays also split each merge into pieces, so the last rounds use every
+ * thread too. Given a consistent order, such as the built-in ones with their
+ * NaNs at the ends, the result is identical to `sort` with the same comparator,
+ * and the same buffers are used. Each thread gets at least 16384 elements, so
+ * short lists are sorted on fewer threads or on the calling thread only;
+ * gathering and scattering the slots of the non-contiguous layouts is not
+ * parallel.
+ *
+ * `compare` is called from several threads at once and must be safe to do so.
+ * The list's allocator is only called from the calling thread.
+ * @param list The list to sort.
+ * @param compare The comparator, or NULL for the natural order of the type.
+ * @param threads Most threads to sort on, the calling thread included. Must be at least 1.
+ */
+void parallelSort(List list, int (*compare)(const void *a, const void *b), int threads);
+
+/**
+ * @brief Sorts a list header on up to `threads` threads, like `parallelSort`.
+ * @param header The header to sort.
+ * @param compare The comparator, or NULL for the natural order of the type.
+ * @param threads Most threads to sort on, the calling thread included. Must be at least 1.
+ */
+void parallelSortHeader(ListHeader *header, int (*compare)(const void *a, const void *b), int threads);
+
+/**
+ * @brief Returns the index of the first element equal to a value.
+ *
+ * The value is passed like the value of `push`. Numbers compare with `==`, so
+ * -0.0 finds 0.0 and NaN finds nothing; `STRING` elements compare with
+ * `strcmp`, `T` elements by pointer and `RECORD` elements byte by byte. Number
+ * lists stored in slots (`ARRAY`, `UNROLLED`, `ROPE`) are scanned a block of
+ * elements at a time, which compilers vectorize.
+ * @param list The list to search.
+ * @param ... The value to look for.
+ * @return The index of the first equal element, or -1 if there is none.
+ */
+int indexOf(List list, ...);
+
+/**
+ * @brief Returns the index of the first element of a list header equal to a value, like `indexOf`.
+ * @param header The header to search.
+ * @param ... The value to look for.
+ * @return The index of the first equal element, or -1 if there is none.
+ */
+int indexOfHeader(ListHeader *header, ...);
+
+/**
+ * @brief Returns the index of the last element equal to a value. See `indexOf`.
+ * @param list The list to search.
+ * @param ... The value to look for.
+ * @return The index of the last equal element, or -1 if there is none.
+ */
+int lastIndexOf(List list, ...);
+
+/**
+ * @brief Returns the index of the last element of a list header equal to a value, like `lastIndexOf`.
+ * @param header The header to search.
+ * @param ... The value to look for.
+ * @return The index of the last equal element, or -1 if there is none.
+ */
+int lastIndexOfHeader(ListHeader *header, ...);
+
+/**
+ * @brief Tells whether the list holds an element equal to a value. See `indexOf`.
+ * @param list The list to search.
+ * @param ... The value to look for.
+ * @return `true` if an equal element exists, `false` otherwise.
+ */
+bool contains(List list, ...);
+
+/**
+ * @brief Tells whether a list header holds an element equal to a value, like `contains`.
+ * @param header The header to search.
+ * @param ... The value to look for.
+ * @return `true` if an equal element exists, `false` otherwise.
+ */
+bool containsHeader(ListHeader *header, ...);
+
+/**
+ * @brief Counts the elements equal to a value. See `indexOf`.
+ * @param list The list to search.
+ * @param ... The value to look for.
+ * @return The number of equal elements.
+ */
+int count(List list, ...);
+
+/**
+ * @brief Counts the elements of a list header equal to a value, like `count`.
+ * @param header The header to search.
+ * @param ... The value to look for.
+ * @return The number of equal elements.
+ */
+int countHeader(ListHeader *header, ...);
+
+/**
+ * @brief Returns the index of the first element a comparator finds equal to a key.
+ *
+ * `compare(key, element)` is called with the element pointers `get` would
+ * return, and an element matches when it returns 0. Use it to search `T`
+ * lists by content instead of by pointer.
+ * @param list The list to search.
+ * @param key The key, passed to `compare` unchanged.
+ * @param compare The comparator.
+ * @return The index of the first matching element, or -1 if there is none.
+ */
+int indexOfWith(List list, const void *key, int (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Returns the index of the first element of a list header matching a key, like `indexOfWith`.
+ * @param header The header to search.
+ * @param key The key, passed to `compare` unchanged.
+ * @param compare The comparator.
+ * @return The index of the first matching element, or -1 if there is none.
+ */
+int indexOfWithHeader(ListHeader *header, const void *key, int (*compare)(const void *a, const void *b));
+
 /**
  * @brief Runs a series of tests on the list implementation.
  *
@@ -105,4 +857,108 @@ void test();
  */
 TIterator newIterator(List list);
 
+/**
+ * @brief Creates a new iterator over a list header, like `newIterator`.
+ * @param header The header to iterate over.
+ * @return A pointer to the newly created iterator.
+ */
+TIterator newIteratorHeader(ListHeader *header);
+
+/**
+ * @brief Creates a new iterator that visits the elements from last to first.
+ *
+ * Available for `DOUBLY` lists, where it runs in O(1) per element. Free it with
+ * `iterator->free(iterator)`.
+ *
+ * @param list The list to iterate over.
+ * @return A pointer to the newly created iterator, or NULL if the list's layout
+ *         cannot be iterated backwards.
+ */
+TIterator newReverseIterator(List list);
+
+/**
+ * @brief Creates a new iterator over a `DOUBLY` list header from last to first, like `newReverseIterator`.
+ * @param header The header to iterate over.
+ * @return A pointer to the newly created iterator, or NULL if the header's layout
+ *         cannot be iterated backwards.
+ */
+TIterator newReverseIteratorHeader(ListHeader *header);
+
+/**
+ * @brief Creates a view of `length` consecutive elements of a list, starting at `start`.
+ *
+ * The view copies nothing: `sliceGet`, `sliceForeach` and `newSliceIterator`
+ * return pointers into the list itself, exactly as `get` does. Taking the
+ * slice positions it on its first element once (O(1) for `ARRAY` and `ROPE`,
+ * O(log n) for `SKIPLIST`, O(start / chunk size) for `UNROLLED`, O(start) for
+ * the other layouts), so iterating it costs only its own length.
+ *
+ * A slice stays valid while elements are only read or replaced with `set`.
+ * Any `push`, `pop`, `popBack`, `insert`, `remove`, `pick`, `pushArray`,
+ * `concat`, `splitAt`, `sort`, `radixSort`, `parallelSort` or `free` on the
+ * list invalidates it, and the slice must be taken again. Using an
+ * invalidated slice is reported as an error.
+ *
+ * Release the slice with `freeSlice`; this does not affect the list.
+ * @param list The list to view. Must outlive the slice.
+ * @param start The index of the first element of the view.
+ * @param length The number of elements in the view.
+ * @return The new slice, or NULL if the range is out of bounds.
+ */
+ListSlice newSlice(List list, int start, int length);
+
+/**
+ * @brief Creates a view of a range of a list header, like `newSlice`.
+ *
+ * The methods in `ops` do not count changes as the `struct Lista` methods do,
+ * so through them only a change of the list's length invalidates the slice.
+ * The functions listed for `newSlice` invalidate it as usual.
+ * @param header The header to view. Must outlive the slice.
+ * @param start The index of the first element of the view.
+ * @param length The number of elements in the view.
+ * @return The new slice, or NULL if the range is out of bounds.
+ */
+ListSlice newSliceHeader(ListHeader *header, int start, int length);
+
+/**
+ * @brief Returns the number of elements in a slice.
+ * @param slice The slice.
+ */
+int sliceLen(ListSlice slice);
+
+/**
+ * @brief Returns a pointer to element `index` of a slice, that is element `start + index` of the list.
+ *
+ * The element is reached from the slice's first element, not from the head of
+ * the list: O(1) for `ARRAY`, O(log n) for `ROPE` and `SKIPLIST`, O(index / chunk
+ * size) for `UNROLLED` and O(index) for the other layouts. Walking a whole slice
+ * is cheaper with `sliceForeach` or `newSliceIterator`.
+ * @param slice The slice.
+ * @param index The zero-based index within the slice.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ */
+void *sliceGet(ListSlice slice, int index);
+
+/**
+ * @brief Applies a function to each element of a slice, in order.
+ * @param slice The slice.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ */
+void sliceForeach(ListSlice slice, void(*function)(void*));
+
+/**
+ * @brief Creates an iterator over the elements of a slice.
+ *
+ * Free it with `iterator->free(iterator)`, like any iterator.
+ * @param slice The slice to iterate over. Must not be NULL.
+ * @return A pointer to the newly created iterator.
+ */
+TIterator newSliceIterator(ListSlice slice);
+
+/**
+ * @brief Frees a slice. The list it views is not affected.
+ * @param slice The slice to free.
+ */
+void freeSlice(ListSlice slice);
+
 #endif
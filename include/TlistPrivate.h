@@ -8,17 +8,261 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+#include <inttypes.h>
 
 /**
  * @struct Node
  * @brief Represents a node in the singly linked list.
+ *
+ * `INT`, `FLOAT` and `DOUBLE` values live in the trailing `_data` bytes of the
+ * node itself, so a node costs a single allocation. `STRING` nodes reserve
+ * `SSO_CAPACITY` bytes there and keep short strings inline, falling back to a
+ * heap copy for longer ones. `_val` always points at the value, wherever it is stored.
  * @private
  */
 struct Node{
-    void *_val;      /**< Pointer to the data stored in the node. */
-    Node _nextNode;  /**< Pointer to the next node in the list. */
+    void *_val;              /**< Pointer to the data stored in the node. Points at `_data` for inline values. */
+    Node _nextNode;          /**< Pointer to the next node in the list. */
+    _Alignas(max_align_t) unsigned char _data[];  /**< Inline storage for value types, sized by the list's `_size`. */
 };
 
+_Static_assert(offsetof(struct Node, _val) == offsetof(struct ListLink, _val)
+               && offsetof(struct Node, _nextNode) == offsetof(struct ListLink, _next)
+               && _Alignof(struct ListLink) >= _Alignof(struct Node),
+               "A ListLink must be usable as the header of a Node");
+
+/**
+ * @brief Inline string capacity of a `STRING` node, including the terminating NUL.
+ * @private
+ */
+#define SSO_CAPACITY 16
+
+/**
+ * @struct StringBlock
+ * @brief A block of a list's string arena.
+ * @private
+ */
+struct StringBlock{
+    struct StringBlock *_next;  /**< The previously allocated block. */
+    size_t _capacity;           /**< Number of bytes in `_bytes`. */
+    char _bytes[];              /**< Packed, NUL-terminated strings. */
+};
+
+/**
+ * @struct StringArena
+ * @brief The string arena of a list, allocated on the first string stored in it.
+ * @private
+ */
+struct StringArena{
+    struct StringBlock *_blocks;  /**< Blocks the strings are packed into, newest first. */
+    size_t _used;                 /**< Bytes used in the newest block. */
+    char **_interned;             /**< Open-addressing set of the arena's strings when interning. */
+    size_t _internCapacity;       /**< Number of buckets in `_interned`. */
+    size_t _internCount;          /**< Number of strings in `_interned`. */
+};
+
+/**
+ * @brief Size of the first block of a string arena. Later blocks double up to `STRING_BLOCK_MAX`.
+ * @private
+ */
+#define STRING_BLOCK_MIN 1024
+
+/**
+ * @brief Largest block a string arena allocates, unless a single string needs more.
+ * @private
+ */
+#define STRING_BLOCK_MAX 65536
+
+/**
+ * @struct Slab
+ * @brief A block of memory the node pool carves nodes from.
+ * @private
+ */
+struct Slab{
+    struct Slab *_next;      /**< The previously allocated slab. */
+    _Alignas(max_align_t) unsigned char _nodes[];  /**< Storage for the slab's nodes, aligned for any element type. */
+};
+
+/**
+ * @brief Default number of nodes per slab used by `enableNodePool`.
+ * @private
+ */
+#define DEFAULT_SLAB_NODES 1024
+
+/**
+ * @struct ListExtras
+ * @brief The state of a list's options, kept out of `ListHeader`.
+ *
+ * A list points at the shared, read-only `noExtras` until an option is enabled,
+ * and `ownExtras` then gives it a copy of its own. Lists with an arena or an
+ * allocator get theirs at creation, in the same `ListBlock` as their `struct
+ * Lista`. The list's `free` method turns every option off again.
+ * @private
+ */
+struct ListExtras{
+    ListArena *_arena;                /**< The arena all storage comes from, or NULL for the heap. */
+    const ListAllocator *_allocator;  /**< The allocator for heap storage, or NULL for the C library. */
+    struct StringArena *_strings;     /**< The string arena, allocated on first use. */
+    struct HashIndex *_hashIndex;     /**< The hash index (see `enableHashIndex`), allocated on first use. */
+    struct Slab *_slabs;              /**< Slabs the node pool carves nodes from, newest first. */
+    Node _freeNodes;                  /**< Nodes handed back to the pool, chained through their next link. */
+    size_t _slabNodes;                /**< Nodes per slab, or 0 when the pool is disabled. */
+    size_t _slabUsed;                 /**< Nodes already carved from the newest slab. */
+    size_t _linkOffset;               /**< Offset of the embedded `ListLink` in intrusive lists. */
+    bool _stringArena;                /**< Whether strings are stored in a string arena (see `enableStringArena`). */
+    bool _intern;                     /**< Whether equal strings share one arena copy. */
+    bool _intrusive;                  /**< Whether elements carry their own links (see `enableIntrusive`). */
+};
+
+_Static_assert(sizeof(ListHeader) <= 80, "Options keep their state in struct ListExtras, not in ListHeader");
+
+/**
+ * @struct ListBlock
+ * @brief A list allocated together with its extension, as lists with an arena or an allocator are.
+ * @private
+ */
+struct ListBlock{
+    struct Lista _list;         /**< The list. Must stay the first member. */
+    struct ListExtras _extras;  /**< Its extension, holding the arena or allocator. */
+};
+
+/**
+ * @brief The extension of lists without options: every option off, the heap for storage.
+ * @private
+ */
+extern const struct ListExtras noExtras;
+
+/**
+ * @brief Points a list at the extension of its `ListBlock`, holding `arena` or `allocator`.
+ * @private
+ */
+void bindMemory(struct ListBlock *block, ListArena *arena, const ListAllocator *allocator);
+
+/**
+ * @brief Returns the list's own extension, allocating it if it still uses `noExtras`.
+ * @private
+ */
+struct ListExtras *ownExtras(ListHeader *this);
+
+/**
+ * @brief Releases the string arena and the hash index and turns every option off.
+ *
+ * A separately allocated extension is freed; one in a `ListBlock` keeps its
+ * arena or allocator. Node pool slabs must already have been released.
+ * @private
+ */
+void releaseExtras(ListHeader *this);
+
+/**
+ * @struct Chunk
+ * @brief A node of an `UNROLLED` list, holding up to `_chunkCapacity` elements.
+ *
+ * Elements are stored back to back in `_items`, `_size` bytes each. Value types
+ * are stored directly; `STRING` and `T` slots hold the pointer. Chunks are never
+ * left empty: a chunk whose last element is removed is unlinked and freed.
+ * @private
+ */
+struct Chunk{
+    struct Chunk *_next;     /**< The next chunk in the list. */
+    int _count;              /**< Number of elements in use. */
+    _Alignas(max_align_t) unsigned char _items[];  /**< Element storage, aligned for any element type. */
+};
+
+/**
+ * @brief One level of a `SKIPLIST` node's links.
+ * @private
+ */
+struct SkipLink{
+    struct SkipNode *_next;  /**< The next node on this level, or NULL. */
+    int _span;               /**< Number of elements this link skips over, counting its target. */
+};
+
+/**
+ * @struct SkipNode
+ * @brief A node of a `SKIPLIST` list.
+ *
+ * The node's `_size`-byte value slot follows its `_height` links, aligned for
+ * any element type.
+ * @private
+ */
+struct SkipNode{
+    int _height;                 /**< Number of levels the node is linked on. */
+    struct SkipLink _links[];    /**< Links, level 0 first, followed by the value slot. */
+};
+
+/**
+ * @brief Maximum number of levels of a `SKIPLIST` list.
+ * @private
+ */
+#define SKIPLIST_MAX_LEVEL 24
+
+/**
+ * @struct RopeNode
+ * @brief A chunk of a `ROPE` list, and a node of the tree that orders the chunks.
+ *
+ * The chunks of a list are the in-order sequence of a treap, a binary search
+ * tree kept balanced by heap-ordered random priorities.
+ * @private
+ */
+struct RopeNode{
+    struct RopeNode *_left;   /**< Subtree of the chunks before this one. */
+    struct RopeNode *_right;  /**< Subtree of the chunks after this one. */
+    int _count;               /**< Number of elements in this subtree. */
+    int _used;                /**< Number of elements in this chunk. */
+    unsigned int _priority;   /**< Heap priority; a parent's is never lower than its children's. */
+    _Alignas(max_align_t) unsigned char _items[];  /**< Element storage, aligned for any element type. */
+};
+
+/**
+ * @brief Bytes of element storage per chunk in a `ROPE` list.
+ * @private
+ */
+#define ROPE_CHUNK_BYTES 1024
+
+/**
+ * @brief Bytes of element storage per chunk in an `UNROLLED` list.
+ * @private
+ */
+#define UNROLLED_CHUNK_BYTES 256
+
+/**
+ * @brief Index that marks the end of an `INDEXED` chain.
+ * @private
+ */
+#define INDEXED_NONE UINT32_MAX
+
+/**
+ * @brief Initial capacity, in nodes, of an `INDEXED` list's pool.
+ * @private
+ */
+#define INDEXED_INITIAL_CAPACITY 16
+
+/**
+ * @brief Initial capacity, in elements, of an `ARRAY` list's buffer.
+ * @private
+ */
+#define ARRAY_INITIAL_CAPACITY 8
+
+/**
+ * @brief Scratch storage for a scalar read from a variadic argument list.
+ * @private
+ */
+typedef union Scalar{
+    int _int;
+    float _float;
+    double _double;
+    int8_t _int8;
+    int16_t _int16;
+    int32_t _int32;
+    int64_t _int64;
+    uint8_t _uint8;
+    uint16_t _uint16;
+    uint32_t _uint32;
+    uint64_t _uint64;
+} Scalar;
+
 /**
  * @struct TIterator
  * @brief Represents an iterator for a `List`.
@@ -26,8 +270,17 @@ struct Node{
  */
 struct TIterator{
     Node _current;                          /**< Pointer to the current node in the iteration. */
-    List _list;                             /**< Pointer to the list being iterated. */
+    Node _previous;                         /**< Node visited before `_current`, for `DOUBLY` lists. */
+    struct Chunk *_chunk;                   /**< Current chunk, for `UNROLLED` lists. */
+    int _slot;                              /**< Position inside `_chunk`. */
+    uint32_t _node;                         /**< Current node, for `INDEXED` lists. */
+    struct SkipNode *_skip;                 /**< Current node, for `SKIPLIST` lists. */
+    struct RopeNode *_leaf;                 /**< Current chunk, for `ROPE` lists. */
+    ListHeader *_list;                      /**< Pointer to the list being iterated. */
+    const ListAllocator *_allocator;        /**< The allocator the iterator came from, or NULL for `malloc`. */
     int _index;                             /**< The index of the current element. */
+    int _remaining;                         /**< Elements left, for slice iterators. */
+    void* (*_step)(struct TIterator*);      /**< The layout's `next`, wrapped by slice iterators. */
     void* (*next)(struct TIterator*);       /**< Method to get the next element. */
     bool (*hasNext)(struct TIterator*);     /**< Method to check if there is a next element. */
     void (*free)(struct TIterator*);        /**< Method to free the iterator structure. */
@@ -36,55 +289,563 @@ struct TIterator{
 /**
  * @brief Creates a new list node.
  * @private
+ * @param this The list the node will belong to.
  * @param val Pointer to the value to be stored.
- * @param size Size of the value type.
- * @param type The type of data being stored.
  * @return The newly created node.
  */
-Node newNode(void *val, size_t size, Type type);
+Node newNode(ListHeader *this, void *val);
+
+/**
+ * @brief Returns the number of bytes a node of this list occupies.
+ * @private
+ */
+size_t nodeSize(ListHeader *this);
+
+/**
+ * @brief Frees a node and the value it owns.
+ * @private
+ */
+void freeNode(ListHeader *this, Node node);
+
+/**
+ * @brief Frees a node and hands its value over to the caller.
+ *
+ * Inline values are copied to a new heap block so that the returned pointer
+ * can be released with `free()` like before.
+ * @private
+ * @return A caller-owned pointer to the node's value.
+ */
+void *releaseNode(ListHeader *this, Node node);
+
+/**
+ * @brief Reads the next variadic argument as a value of the list's type.
+ * @private
+ * @return A pointer to the value, suitable for `newNode` and the other storage helpers.
+ */
+void *readValue(ListHeader *this, va_list *args, Scalar *buf);
+
+/**
+ * @brief Allocates `size` bytes for a list, from its `ListArena` or `ListAllocator` if it has one.
+ * @return The memory, or NULL when it cannot be allocated.
+ * @private
+ */
+void *allocate(ListHeader *this, size_t size);
+
+/**
+ * @brief Resizes a block obtained from `allocate`, like `realloc`.
+ * @return The resized block, or NULL when it cannot be allocated (the old block is kept).
+ * @private
+ */
+void *reallocate(ListHeader *this, void *ptr, size_t oldSize, size_t size);
+
+/**
+ * @brief Releases a block obtained from `allocate`. A no-op for arena lists.
+ * @private
+ */
+void deallocate(ListHeader *this, void *ptr);
+
+/**
+ * @brief Makes a list-owned copy of a string, in the string arena if the list has one.
+ * @private
+ */
+char *copyString(ListHeader *this, const char *str);
+
+/**
+ * @brief Whether `copyString` returns plain `malloc` blocks, which `pop` and `pick` can hand to the caller as is.
+ * @private
+ */
+bool mallocStrings(ListHeader *this);
+
+/**
+ * @brief Releases a string obtained from `copyString`. A no-op for arena strings.
+ * @private
+ */
+void releaseString(ListHeader *this, char *str);
+
+/**
+ * @brief Drops the string arena of a list.
+ * @private
+ */
+void releaseStrings(ListHeader *this);
+
+/**
+ * @brief Returns the value held by an element slot, as `get` exposes it.
+ * @private
+ */
+void *slotValue(ListHeader *this, unsigned char *slot);
+
+/**
+ * @brief Stores a value into an element slot, copying strings.
+ * @private
+ */
+void storeValue(ListHeader *this, unsigned char *slot, void *val);
+
+/**
+ * @brief Releases the memory an element slot owns (only strings own memory).
+ * @private
+ */
+void releaseSlot(ListHeader *this, unsigned char *slot);
+
+/**
+ * @brief Hands the value of an element slot over to the caller, as `pop` and `pick` return it.
+ * @private
+ */
+void *takeSlot(ListHeader *this, unsigned char *slot);
+
+/**
+ * @brief Prints a single value of the list's type to stdout.
+ * @private
+ */
+void printValue(ListHeader *this, void *val);
+
+/**
+ * @brief Operations tables of the `LINKED`, `UNROLLED`, `ARRAY`, `INDEXED`, `DOUBLY`, `SKIPLIST` and `ROPE` layouts.
+ * @private
+ */
+extern const struct ListOps linkedOps;
+/** @private */
+extern const struct ListOps unrolledOps;
+/** @private */
+extern const struct ListOps arrayOps;
+/** @private */
+extern const struct ListOps indexedOps;
+/** @private */
+extern const struct ListOps doublyOps;
+/** @private */
+extern const struct ListOps skiplistOps;
+/** @private */
+extern const struct ListOps ropeOps;
+
+/**
+ * @brief Returns the operations table of a layout.
+ * @private
+ */
+const struct ListOps *layoutOps(Layout layout);
 
 /**
  * @brief Implementation for the `print` method. Prints the list to stdout.
  * @private
  */
-void print(List this);
+void print(ListHeader *this);
 
 /**
  * @brief Implementation for the `push` method. Adds an element to the end of the list.
+ *
+ * Shared by all layouts: reads the value and hands it to the layout's `_pushValue`.
+ * @private
+ */
+void push(ListHeader *this, ...);
+
+/**
+ * @brief Implementation for the `set` method. Shared by all layouts, like `push`.
+ * @private
+ */
+void set(ListHeader *this, int index, ...);
+
+/**
+ * @brief Implementation for the `insert` method. Shared by all layouts, like `push`.
+ * @private
+ */
+void insert(ListHeader *this, int index, ...);
+
+/** @private */
+void pushValue(ListHeader *this, void *val);
+
+/**
+ * @brief Appends `n` values in slot format by calling the layout's `_pushValue` for each.
+ *
+ * The `_pushValues` of layouts without a bulk path.
+ * @private
+ */
+void pushValues(ListHeader *this, const unsigned char *src, size_t n);
+/** @private */
+void arrayPushValues(ListHeader *this, const unsigned char *src, size_t n);
+/** @private */
+void unrolledPushValues(ListHeader *this, const unsigned char *src, size_t n);
+
+/**
+ * @brief Moves the elements of `src` to the end of `this` one by one.
+ *
+ * The `_concat` of layouts that cannot relink, and the fallback of `concat`
+ * when two lists do not share their memory. The values are pushed from their
+ * slots through an iterator, then `src` is freed in one walk and its options
+ * are turned back on. Intrusive elements are popped before they are pushed,
+ * since their link is their node.
+ * @private
+ */
+void concatValues(ListHeader *this, ListHeader *src);
+
+/**
+ * @brief Moves the elements from `index` onwards to `suffix` one by one, like `concatValues`.
+ *
+ * The elements before `index` are left alone. `INDEXED` lists copy the suffix
+ * out in one walk. The other layouts push it from its slots through an
+ * iterator, then remove it without copying: `LINKED` lists from its front,
+ * where the cursor keeps the node before `index` at hand, and the other
+ * layouts from the back. Intrusive elements are picked before they are pushed.
+ * @private
+ */
+void splitValues(ListHeader *this, int index, ListHeader *suffix);
+/** @private */
+void concatNodes(ListHeader *this, ListHeader *src);
+/** @private */
+void splitNodes(ListHeader *this, int index, ListHeader *suffix);
+/** @private */
+void doublyConcat(ListHeader *this, ListHeader *src);
+/** @private */
+void doublySplitAt(ListHeader *this, int index, ListHeader *suffix);
+/** @private */
+void unrolledConcat(ListHeader *this, ListHeader *src);
+/** @private */
+void unrolledSplitAt(ListHeader *this, int index, ListHeader *suffix);
+/** @private */
+void arrayConcat(ListHeader *this, ListHeader *src);
+/** @private */
+void arraySplitAt(ListHeader *this, int index, ListHeader *suffix);
+/** @private */
+void ropeConcat(ListHeader *this, ListHeader *src);
+/** @private */
+void ropeSplitAt(ListHeader *this, int index, ListHeader *suffix);
+
+/**
+ * @struct SortPlan
+ * @brief How `sort`, `radixSort` and `parallelSort` order a list, handed down to the layout's `_sort`.
+ * @private
+ */
+struct SortPlan{
+    int (*compare)(const void *, const void *);  /**< The user comparator, or NULL for the built-in order. */
+    bool radix;                                  /**< Whether to radix sort the numeric keys instead of merging. */
+    int threads;                                 /**< Most threads a merge sort may run on. */
+};
+
+/**
+ * @brief Sorts a chain of nodes by relinking them.
+ * @param this A pointer to the list, for its type.
+ * @param head The first node of a NULL-terminated chain.
+ * @param tail Receives the last node of the sorted chain.
+ * @param plan How to sort.
+ * @return The first node of the sorted chain.
+ * @private
+ */
+Node sortNodes(ListHeader *this, Node head, Node *tail, const struct SortPlan *plan);
+
+/**
+ * @brief Sorts an array of `length` slots in place, through one scratch buffer.
+ * @private
+ */
+void sortSlots(ListHeader *this, unsigned char *items, int length, const struct SortPlan *plan);
+
+/**
+ * @brief Sorts a list whose slots are not contiguous.
+ *
+ * `move` copies every slot, in list order, into `items` when `scatter` is
+ * false and back from `items` when it is true; the slots are sorted in between.
+ * @private
+ */
+void sortGathered(ListHeader *this, const struct SortPlan *plan,
+                  void (*move)(ListHeader *this, unsigned char *items, bool scatter));
+/** @private */
+void sortChain(ListHeader *this, const struct SortPlan *plan);
+/** @private */
+void doublySort(ListHeader *this, const struct SortPlan *plan);
+/** @private */
+void arraySort(ListHeader *this, const struct SortPlan *plan);
+/** @private */
+void unrolledSort(ListHeader *this, const struct SortPlan *plan);
+/** @private */
+void indexedSort(ListHeader *this, const struct SortPlan *plan);
+/** @private */
+void skiplistSort(ListHeader *this, const struct SortPlan *plan);
+/** @private */
+void ropeSort(ListHeader *this, const struct SortPlan *plan);
+
+/**
+ * @brief What a search reports.
+ * @private
+ */
+typedef enum SearchMode{
+    FIND_FIRST,  /**< The index of the first match, or -1. */
+    FIND_LAST,   /**< The index of the last match, or -1. */
+    FIND_COUNT,  /**< The number of matches. */
+    FIND_ANY     /**< A non-negative number if there is a match, or -1; scans report the first index. */
+} SearchMode;
+
+/**
+ * @struct SearchPlan
+ * @brief What `indexOf` and the other searches look for, handed down to the layout's `_find`.
+ * @private
+ */
+struct SearchPlan{
+    const void *key;                              /**< The value searched for, as `get` would return it. */
+    int (*compare)(const void *, const void *);  /**< The user comparator, or NULL for the built-in equality. */
+    SearchMode mode;                              /**< What to report. */
+};
+
+/**
+ * @struct HashEntry
+ * @brief A distinct value of a hash-indexed list and the number of elements equal to it.
+ * @private
+ */
+struct HashEntry{
+    size_t _hash;             /**< Hash of the value. */
+    int _count;               /**< Number of equal elements; 0 marks an empty entry. */
+    union {
+        uint64_t _bits;       /**< The value of a number or `T` element. */
+        void *_copy;          /**< A copy of a `STRING` or `RECORD` value, owned by the index. */
+    } _key;
+};
+
+/**
+ * @struct HashIndex
+ * @brief The hash index of a list, allocated on the first value indexed.
+ *
+ * An open-addressing table with linear probing, at most half full.
+ * @private
+ */
+struct HashIndex{
+    struct HashEntry *_entries;  /**< The entries; a power of two of them. */
+    size_t _capacity;            /**< Number of entries. */
+    size_t _used;                /**< Number of distinct values. */
+};
+
+/**
+ * @brief Operations of lists with a hash index, wrapping those of their layout.
+ * @private
+ */
+extern const struct ListOps hashedOps;
+
+/**
+ * @brief Frees the hash table of a list and the keys it copied. Called by `releaseExtras`.
+ * @private
+ */
+void releaseIndex(ListHeader *this);
+
+/**
+ * @brief Drops the elements from `index` onwards from a list's hash index,
+ * before they are moved out without going through its methods.
  * @private
  */
-void push(List this, ...);
+void unindexFrom(ListHeader *this, int index);
+
+/**
+ * @brief Searches an array of `length` slots.
+ * @return The result for `plan->mode`, with indices relative to `items`.
+ * @private
+ */
+int searchSlots(ListHeader *this, const unsigned char *items, int length, const struct SearchPlan *plan);
+
+/**
+ * @brief Searches a NULL-terminated chain of nodes.
+ * @return The result for `plan->mode`, with indices relative to `head`.
+ * @private
+ */
+int searchNodes(ListHeader *this, Node head, const struct SearchPlan *plan);
+
+/**
+ * @brief Searches any list through its iterator.
+ * @private
+ */
+int searchValues(ListHeader *this, const struct SearchPlan *plan);
+/** @private */
+int findChain(ListHeader *this, const struct SearchPlan *plan);
+/** @private */
+int arrayFind(ListHeader *this, const struct SearchPlan *plan);
+/** @private */
+int unrolledFind(ListHeader *this, const struct SearchPlan *plan);
+/** @private */
+int ropeFind(ListHeader *this, const struct SearchPlan *plan);
 
 /**
  * @brief Implementation for the `len` method. Returns the number of elements.
  * @private
  */
-int len(List this);
+int len(ListHeader *this);
 
 /**
  * @brief Implementation for the `free` method. Frees all nodes and their data.
  * @private
  */
-void destroyList(List this);
+void destroyList(ListHeader *this);
 
 /**
  * @brief Implementation for the `pop` method. Removes and returns the first element.
  * @private
  */
-void *pop(List this);
+void *pop(ListHeader *this);
 
+/**
+ * @brief Initializes a list header, with the element size of `RECORD` lists.
+ * @private
+ */
+void initHeader(ListHeader *this, Type type, size_t recordSize, Layout layout);
+
+/**
+ * @brief Returns the header of a list, or NULL for a NULL list.
+ *
+ * Lets the functions taking a `List` share their code with their `ListHeader`
+ * variants, which report the NULL.
+ * @private
+ */
+static inline ListHeader *headerOf(List list){
+    return list == NULL ? NULL : &list->_header;
+}
+
+/**
+ * @brief Implementation for the `popBack` method. Removes and returns the last element.
+ *
+ * Shared by the layouts without a faster way: it is `pick` at the last index.
+ * @private
+ */
+void *popBack(ListHeader *this);
+
+/**
+ * @brief Replaces the value a node holds, releasing the old one.
+ * @private
+ */
+void replaceValue(ListHeader *this, Node node, void *val);
+
+/** @private */
+void *get(ListHeader *this, int index);
+/** @private */
+void setValue(ListHeader *this, int index, void *val);
+/** @private */
+void delete(ListHeader *this, int index);
+/** @private */
+void insertValue(ListHeader *this, int index, void *val);
+/** @private */
+void *pick(ListHeader *this, int index);
+/** @private */
+void foreach(ListHeader *this, void(*function)(void*));
+
+/** @private */
+void unrolledPrint(ListHeader *this);
+/** @private */
+void unrolledPushValue(ListHeader *this, void *val);
+/** @private */
+void unrolledDestroy(ListHeader *this);
+/** @private */
+void *unrolledPop(ListHeader *this);
+/** @private */
+void *unrolledGet(ListHeader *this, int index);
 /** @private */
-void *get(List this, int index);
+void unrolledSetValue(ListHeader *this, int index, void *val);
 /** @private */
-void set(List this, int index, ...);
+void unrolledDelete(ListHeader *this, int index);
 /** @private */
-void delete(List this, int index);
+void unrolledInsertValue(ListHeader *this, int index, void *val);
 /** @private */
-void insert(List this, int index, ...);
+void *unrolledPick(ListHeader *this, int index);
 /** @private */
-void *pick(List this, int index);
+void unrolledForeach(ListHeader *this, void(*function)(void*));
+
+/** @private */
+void arrayPrint(ListHeader *this);
+/** @private */
+void arrayPushValue(ListHeader *this, void *val);
+/** @private */
+void arrayDestroy(ListHeader *this);
+/** @private */
+void *arrayPop(ListHeader *this);
+/** @private */
+void *arrayGet(ListHeader *this, int index);
+/** @private */
+void arraySetValue(ListHeader *this, int index, void *val);
 /** @private */
-void foreach(List this, void(*function)(void*));
+void arrayDelete(ListHeader *this, int index);
+/** @private */
+void arrayInsertValue(ListHeader *this, int index, void *val);
+/** @private */
+void *arrayPick(ListHeader *this, int index);
+/** @private */
+void arrayForeach(ListHeader *this, void(*function)(void*));
+
+/** @private */
+void indexedPrint(ListHeader *this);
+/** @private */
+void indexedPushValue(ListHeader *this, void *val);
+/** @private */
+void indexedDestroy(ListHeader *this);
+/** @private */
+void *indexedPop(ListHeader *this);
+/** @private */
+void *indexedGet(ListHeader *this, int index);
+/** @private */
+void indexedSetValue(ListHeader *this, int index, void *val);
+/** @private */
+void indexedDelete(ListHeader *this, int index);
+/** @private */
+void indexedInsertValue(ListHeader *this, int index, void *val);
+/** @private */
+void *indexedPick(ListHeader *this, int index);
+/** @private */
+void indexedForeach(ListHeader *this, void(*function)(void*));
+/** @private */
+void indexedSplitAt(ListHeader *this, int index, ListHeader *suffix);
+
+/** @private */
+void doublyPrint(ListHeader *this);
+/** @private */
+void doublyPushValue(ListHeader *this, void *val);
+/** @private */
+void doublyDestroy(ListHeader *this);
+/** @private */
+void *doublyPop(ListHeader *this);
+/** @private */
+void *doublyPopBack(ListHeader *this);
+/** @private */
+void *doublyGet(ListHeader *this, int index);
+/** @private */
+void doublySetValue(ListHeader *this, int index, void *val);
+/** @private */
+void doublyDelete(ListHeader *this, int index);
+/** @private */
+void doublyInsertValue(ListHeader *this, int index, void *val);
+/** @private */
+void *doublyPick(ListHeader *this, int index);
+/** @private */
+void doublyForeach(ListHeader *this, void(*function)(void*));
+
+/** @private */
+void skiplistPrint(ListHeader *this);
+/** @private */
+void skiplistPushValue(ListHeader *this, void *val);
+/** @private */
+void skiplistDestroy(ListHeader *this);
+/** @private */
+void *skiplistPop(ListHeader *this);
+/** @private */
+void *skiplistGet(ListHeader *this, int index);
+/** @private */
+void skiplistSetValue(ListHeader *this, int index, void *val);
+/** @private */
+void skiplistDelete(ListHeader *this, int index);
+/** @private */
+void skiplistInsertValue(ListHeader *this, int index, void *val);
+/** @private */
+void *skiplistPick(ListHeader *this, int index);
+/** @private */
+void skiplistForeach(ListHeader *this, void(*function)(void*));
+
+/** @private */
+void ropePrint(ListHeader *this);
+/** @private */
+void ropePushValue(ListHeader *this, void *val);
+/** @private */
+void ropeDestroy(ListHeader *this);
+/** @private */
+void *ropePop(ListHeader *this);
+/** @private */
+void *ropeGet(ListHeader *this, int index);
+/** @private */
+void ropeSetValue(ListHeader *this, int index, void *val);
+/** @private */
+void ropeDelete(ListHeader *this, int index);
+/** @private */
+void ropeInsertValue(ListHeader *this, int index, void *val);
+/** @private */
+void *ropePick(ListHeader *this, int index);
+/** @private */
+void ropeForeach(ListHeader *this, void(*function)(void*));
 
 /**
  * @brief Implementation for the iterator's `next` method. Returns the next element.
@@ -98,10 +859,69 @@ void* next(TIterator iterator);
  */
 bool hasNext(TIterator iterator);
 
+/** @private */
+void *unrolledNext(TIterator iterator);
+/** @private */
+bool unrolledHasNext(TIterator iterator);
+
+/** @private */
+void *arrayNext(TIterator iterator);
+/** @private */
+bool arrayHasNext(TIterator iterator);
+
+/** @private */
+void *indexedNext(TIterator iterator);
+/** @private */
+bool indexedHasNext(TIterator iterator);
+
+/** @private */
+void *doublyNext(TIterator iterator);
+
+/** @private */
+void *skiplistNext(TIterator iterator);
+/** @private */
+bool skiplistHasNext(TIterator iterator);
+
+/** @private */
+void *ropeNext(TIterator iterator);
+/** @private */
+bool ropeHasNext(TIterator iterator);
+
 /**
  * @brief Implementation for the iterator's `free` method. Frees the iterator.
  * @private
  */
 void freeIterator(TIterator iterator);
 
+/**
+ * @brief Positions an already allocated iterator at the first element of a list.
+ * @private
+ */
+void startIterator(TIterator iterator, ListHeader *header, const ListAllocator *allocator);
+
+/**
+ * @brief Moves an iterator forward by `steps` elements, which must all exist.
+ *
+ * O(1) for `ARRAY` and `ROPE`, O(log n) for `SKIPLIST`, a walk a chunk at a
+ * time for `UNROLLED` and an element at a time elsewhere.
+ * @private
+ */
+void advanceIterator(TIterator iterator, int steps);
+
+/** @private */
+struct SkipNode *skiplistNodeAt(ListHeader *this, int index);
+
+/**
+ * @struct ListSlice
+ * @brief A view of consecutive elements of a list. See `newSlice`.
+ * @private
+ */
+struct ListSlice{
+    struct TIterator _first;  /**< Iterator state positioned at the first element of the view. */
+    int _start;               /**< Index of the first element in the list. */
+    int _length;              /**< Number of elements in the view. */
+    unsigned int _version;    /**< The list's `_version` when the view was taken. */
+    int _listLength;          /**< The list's length when the view was taken. */
+};
+
 #endif
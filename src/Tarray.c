@@ -0,0 +1,382 @@
+/**
+ * @file Tarray.c
+ * @brief Implementation of the `ARRAY` list layout.
+ *
+ * An array list keeps its elements back to back in one growable buffer, so
+ * `get` and `set` are O(1) and traversal is a linear scan. The live elements
+ * start at `_offset`: `pop` and removal at index 0 just advance it, and the
+ * free space in front is reclaimed when the buffer would otherwise grow.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Returns the address of the slot holding element `index`.
+ * @private
+ */
+static unsigned char *slotAt(ListHeader *this, int index){
+    return this->_items + (size_t)(this->_offset + index) * this->_size;
+}
+
+/**
+ * @brief Makes room for `extra` more elements after the last one.
+ *
+ * The free space in front of the elements is reused when it makes up at least
+ * half of the buffer; otherwise the buffer doubles, which keeps both paths
+ * amortized O(1) per element.
+ * @private
+ */
+static void reserve(ListHeader *this, int extra){
+    int needed = this->_length + extra;
+    if (this->_offset + needed <= this->_capacity) return;
+
+    if (this->_offset >= this->_capacity / 2 && needed <= this->_capacity) {
+        memmove(this->_items, slotAt(this, 0), (size_t)this->_length * this->_size);
+        this->_offset = 0;
+        return;
+    }
+    int capacity = this->_capacity * 2;
+    if (capacity < this->_offset + needed) capacity = this->_offset + needed;
+    if (capacity < ARRAY_INITIAL_CAPACITY) capacity = ARRAY_INITIAL_CAPACITY;
+    unsigned char *items = reallocate(this, this->_items, (size_t)this->_capacity * this->_size, (size_t)capacity * this->_size);
+    if (items == NULL) {
+        fprintf(stderr, "Error in reserve(): Failed to grow the array buffer to %d elements.\n", capacity);
+        exit(EXIT_FAILURE);
+    }
+    this->_items = items;
+    this->_capacity = capacity;
+}
+
+/**
+ * @brief Removes element `index` from the buffer, without releasing its value.
+ * @private
+ */
+static void removeAt(ListHeader *this, int index){
+    if (index == 0) {
+        this->_offset++;
+    } else {
+        memmove(slotAt(this, index), slotAt(this, index + 1),
+                (size_t)(this->_length - index - 1) * this->_size);
+    }
+    this->_length--;
+    if (this->_length == 0) {
+        this->_offset = 0;
+    }
+}
+
+/**
+ * @brief Prints the contents of the list to standard output.
+ * @param this A pointer to the list.
+ * @private
+ */
+void arrayPrint(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
+        return;
+    }
+    printf("[");
+    for (int i = 0; i < this->_length; i++){
+        printValue(this, slotValue(this, slotAt(this, i)));
+        if (i + 1 < this->_length){
+            printf(", ");
+        }
+    }
+    printf("]");
+    printf("\n");
+}
+
+/**
+ * @brief Frees the element buffer and the strings it owns.
+ *
+ * As with the `LINKED` layout, pointers stored in a `T` list are not freed.
+ * This function does NOT free the `List` struct itself.
+ * @param this A pointer to the list.
+ * @private
+ */
+void arrayDestroy(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (this->_type == STRING && !this->_extras->_stringArena) {
+        for (int i = 0; i < this->_length; i++){
+            releaseSlot(this, slotAt(this, i));
+        }
+    }
+    releaseExtras(this);
+    deallocate(this, this->_items);
+    this->_items = NULL;
+    this->_offset = 0;
+    this->_capacity = 0;
+    this->_length = 0;
+}
+
+/**
+ * @brief Adds a new element to the end of the list.
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void arrayPushValue(ListHeader *this, void *val){
+    reserve(this, 1);
+    storeValue(this, slotAt(this, this->_length), val);
+    this->_length++;
+}
+
+/**
+ * @brief Appends `n` values from an array, growing the buffer at most once.
+ *
+ * Value types are copied with a single `memcpy`; strings are copied one by one.
+ * @param this A pointer to the list.
+ * @param src The values, in slot format.
+ * @param n Number of values.
+ * @private
+ */
+void arrayPushValues(ListHeader *this, const unsigned char *src, size_t n){
+    reserve(this, (int)n);
+    if (this->_type == STRING) {
+        for (size_t i = 0; i < n; i++){
+            storeValue(this, slotAt(this, this->_length + (int)i), slotValue(this, (unsigned char *)src + i * this->_size));
+        }
+    } else {
+        memcpy(slotAt(this, this->_length), src, n * this->_size);
+    }
+    this->_length += (int)n;
+}
+
+/**
+ * @brief Removes the first element of the list and returns its value.
+ *
+ * Runs in O(1): the start of the array moves forward instead of shifting the elements.
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *arrayPop(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_length == 0) {
+        return NULL;
+    }
+    void *val = takeSlot(this, slotAt(this, 0));
+    removeAt(this, 0);
+    return val;
+}
+
+/**
+ * @brief Retrieves a pointer to the element at a specific index in O(1).
+ *
+ * The returned pointer is invalidated by any operation that grows or shifts the buffer.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to retrieve.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *arrayGet(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    return slotValue(this, slotAt(this, index));
+}
+
+/**
+ * @brief Updates the value of an element at a specific index in O(1).
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void arraySetValue(ListHeader *this, int index, void *val){
+    if (index < 0) {
+        fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    releaseSlot(this, slotAt(this, index));
+    storeValue(this, slotAt(this, index), val);
+}
+
+/**
+ * @brief Deletes the element at a specific index, freeing the string it owns.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to delete.
+ * @private
+ */
+void arrayDelete(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    releaseSlot(this, slotAt(this, index));
+    removeAt(this, index);
+}
+
+/**
+ * @brief Inserts a new element at a specific index.
+ *
+ * Inserting at index 0 reuses the free space left by `pop` when there is any.
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void arrayInsertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
+    }
+    if (index == 0 && this->_offset > 0) {
+        this->_offset--;
+    } else {
+        reserve(this, 1);
+        memmove(slotAt(this, index + 1), slotAt(this, index),
+                (size_t)(this->_length - index) * this->_size);
+    }
+    storeValue(this, slotAt(this, index), val);
+    this->_length++;
+}
+
+/**
+ * @brief Removes and returns the element at a specific index.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to remove.
+ * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *arrayPick(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    void *val = takeSlot(this, slotAt(this, index));
+    removeAt(this, index);
+    return val;
+}
+
+/**
+ * @brief Applies a given function to each element in the list.
+ * @param this A pointer to the list.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ * @private
+ */
+void arrayForeach(ListHeader *this, void(*function)(void*)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
+        return;
+    }
+    unsigned char *slot = slotAt(this, 0);
+    for (int i = 0; i < this->_length; i++, slot += this->_size){
+        function(slotValue(this, slot));
+    }
+}
+
+/**
+ * @brief Returns the next element of an `ARRAY` list iteration.
+ * @param iterator A pointer to the iterator.
+ * @return A pointer to the next element's value, or `NULL` if the end is reached or the iterator is invalid.
+ * @private
+ */
+void *arrayNext(TIterator iterator){
+    if (iterator == NULL || iterator->_index >= iterator->_list->_length) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    return slotValue(iterator->_list, slotAt(iterator->_list, iterator->_index++));
+}
+
+/**
+ * @brief Checks if an `ARRAY` list iteration has more elements.
+ * @param iterator A pointer to the iterator.
+ * @return `true` if there is at least one more element to iterate over, `false` otherwise.
+ * @private
+ */
+bool arrayHasNext(TIterator iterator){
+    if (iterator == NULL) {
+        return false;
+    }
+    return iterator->_index < iterator->_list->_length;
+}
+
+/**
+ * @brief Moves the slots of `src` to the end of the buffer with one copy.
+ *
+ * Strings move with their slots and are not copied.
+ * @private
+ */
+void arrayConcat(ListHeader *this, ListHeader *src){
+    if (src->_length == 0) return;
+    reserve(this, src->_length);
+    memcpy(slotAt(this, this->_length), slotAt(src, 0), (size_t)src->_length * this->_size);
+    this->_length += src->_length;
+    src->_length = 0;
+    src->_offset = 0;
+}
+
+/**
+ * @brief Moves the slots from `index` onwards into `suffix` with one copy.
+ * @private
+ */
+void arraySplitAt(ListHeader *this, int index, ListHeader *suffix){
+    int moved = this->_length - index;
+    reserve(suffix, moved);
+    memcpy(slotAt(suffix, 0), slotAt(this, index), (size_t)moved * this->_size);
+    suffix->_length = moved;
+    this->_length = index;
+}
+
+/**
+ * @brief Sorts the buffer in place.
+ * @private
+ */
+void arraySort(ListHeader *this, const struct SortPlan *plan){
+    sortSlots(this, slotAt(this, 0), this->_length, plan);
+}
+
+/**
+ * @brief Searches the buffer in one pass.
+ * @private
+ */
+int arrayFind(ListHeader *this, const struct SearchPlan *plan){
+    return searchSlots(this, slotAt(this, 0), this->_length, plan);
+}
+
+/** @private */
+const struct ListOps arrayOps = {
+    push, arrayPop, arrayPrint, len, arrayDestroy, arrayGet, set, arrayDelete, insert, arrayPick, arrayForeach,
+    popBack, arrayPushValue, arraySetValue, arrayInsertValue, arrayPushValues,
+    arrayConcat, arraySplitAt, arraySort, arrayFind
+};
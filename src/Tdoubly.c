@@ -0,0 +1,426 @@
+/**
+ * @file Tdoubly.c
+ * @brief Implementation of the `DOUBLY` list layout.
+ *
+ * A doubly linked list that keeps a single link per node: `_nextNode` holds the
+ * XOR of the addresses of the previous and next nodes. Given either neighbour
+ * of a node, the other one is recovered by XOR-ing it with the link, so the
+ * list can be walked from either end with the same code and nodes are exactly
+ * as large as in a `LINKED` list. Nodes are created and released by the same
+ * functions as `LINKED` nodes, so inline values, short strings, the node pool
+ * and the string arena all work unchanged.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Combines two node addresses into an XOR link, or recovers one from the other.
+ * @private
+ */
+static Node xorLink(Node a, Node b){
+    return (Node)((uintptr_t)a ^ (uintptr_t)b);
+}
+
+/**
+ * @brief Finds the node at a position, walking from the nearer end.
+ *
+ * The index must be in bounds.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the node.
+ * @param prev Receives the node before it, or NULL at the head.
+ * @param next Receives the node after it, or NULL at the tail.
+ * @return The node at `index`.
+ * @private
+ */
+static Node locate(ListHeader *this, int index, Node *prev, Node *next){
+    Node before = NULL;
+    Node current = this->_head;
+    int steps = index;
+    if (index >= this->_length / 2) {
+        current = this->_tail;
+        steps = this->_length - 1 - index;
+    }
+    for (int i = 0; i < steps; i++){
+        Node following = xorLink(current->_nextNode, before);
+        before = current;
+        current = following;
+    }
+    Node after = xorLink(current->_nextNode, before);
+    if (index >= this->_length / 2) {
+        *prev = after;
+        *next = before;
+    } else {
+        *prev = before;
+        *next = after;
+    }
+    return current;
+}
+
+/**
+ * @brief Links a node in between two neighbours, either of which may be NULL.
+ * @private
+ */
+static void linkBetween(ListHeader *this, Node node, Node prev, Node next){
+    node->_nextNode = xorLink(prev, next);
+    if (prev == NULL) {
+        this->_head = node;
+    } else {
+        prev->_nextNode = xorLink(xorLink(prev->_nextNode, next), node);
+    }
+    if (next == NULL) {
+        this->_tail = node;
+    } else {
+        next->_nextNode = xorLink(xorLink(next->_nextNode, prev), node);
+    }
+    this->_length++;
+}
+
+/**
+ * @brief Unlinks a node from its neighbours, without releasing it.
+ * @private
+ */
+static void unlinkBetween(ListHeader *this, Node node, Node prev, Node next){
+    if (prev == NULL) {
+        this->_head = next;
+    } else {
+        prev->_nextNode = xorLink(xorLink(prev->_nextNode, node), next);
+    }
+    if (next == NULL) {
+        this->_tail = prev;
+    } else {
+        next->_nextNode = xorLink(xorLink(next->_nextNode, node), prev);
+    }
+    this->_length--;
+}
+
+/**
+ * @brief Prints the contents of the list to standard output.
+ * @param this A pointer to the list.
+ * @private
+ */
+void doublyPrint(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
+        return;
+    }
+    printf("[");
+    Node prev = NULL;
+    for (Node current = this->_head; current != NULL;){
+        printValue(this, current->_val);
+        Node next = xorLink(current->_nextNode, prev);
+        if (next != NULL){
+            printf(", ");
+        }
+        prev = current;
+        current = next;
+    }
+    printf("]");
+    printf("\n");
+}
+
+/**
+ * @brief Frees all the nodes in the list and the data they contain.
+ *
+ * The XOR links are turned back into plain forward links first, so that the
+ * nodes can be released exactly like those of a `LINKED` list.
+ * This function does NOT free the `List` struct itself.
+ * @param this A pointer to the list.
+ * @private
+ */
+void doublyDestroy(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
+        return;
+    }
+    Node prev = NULL;
+    for (Node current = this->_head; current != NULL;){
+        Node next = xorLink(current->_nextNode, prev);
+        current->_nextNode = next;
+        prev = current;
+        current = next;
+    }
+    destroyList(this);
+}
+
+/**
+ * @brief Adds a new element to the end of the list.
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void doublyPushValue(ListHeader *this, void *val){
+    linkBetween(this, newNode(this, val), this->_tail, NULL);
+}
+
+/**
+ * @brief Removes the first element of the list and returns its value.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *doublyPop(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_head == NULL) {
+        return NULL;
+    }
+    Node node = this->_head;
+    unlinkBetween(this, node, NULL, node->_nextNode);
+    return releaseNode(this, node);
+}
+
+/**
+ * @brief Removes the last element of the list and returns its value in O(1).
+ *
+ * The caller takes ownership of the returned pointer, exactly as with `pop`.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *doublyPopBack(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in popBack(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_tail == NULL) {
+        return NULL;
+    }
+    Node node = this->_tail;
+    unlinkBetween(this, node, node->_nextNode, NULL);
+    return releaseNode(this, node);
+}
+
+/**
+ * @brief Retrieves a pointer to the element at a specific index, walking from the nearer end.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to retrieve.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *doublyGet(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    Node prev, next;
+    return locate(this, index, &prev, &next)->_val;
+}
+
+/**
+ * @brief Updates the value of an element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void doublySetValue(ListHeader *this, int index, void *val){
+    if (index < 0) {
+        fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    Node prev, next;
+    replaceValue(this, locate(this, index, &prev, &next), val);
+}
+
+/**
+ * @brief Deletes the element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to delete.
+ * @private
+ */
+void doublyDelete(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    Node prev, next;
+    Node node = locate(this, index, &prev, &next);
+    unlinkBetween(this, node, prev, next);
+    freeNode(this, node);
+}
+
+/**
+ * @brief Inserts a new element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void doublyInsertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
+    }
+    if (index == this->_length) {
+        doublyPushValue(this, val);
+        return;
+    }
+    Node prev, next;
+    Node node = locate(this, index, &prev, &next);
+    linkBetween(this, newNode(this, val), prev, node);
+}
+
+/**
+ * @brief Removes and returns the element at a specific index, walking from the nearer end.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to remove.
+ * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *doublyPick(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    Node prev, next;
+    Node node = locate(this, index, &prev, &next);
+    unlinkBetween(this, node, prev, next);
+    return releaseNode(this, node);
+}
+
+/**
+ * @brief Applies a given function to each element in the list.
+ * @param this A pointer to the list.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ * @private
+ */
+void doublyForeach(ListHeader *this, void(*function)(void*)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
+        return;
+    }
+    Node prev = NULL;
+    for (Node current = this->_head; current != NULL;){
+        Node next = xorLink(current->_nextNode, prev);
+        function(current->_val);
+        prev = current;
+        current = next;
+    }
+}
+
+/**
+ * @brief Returns the next element of a `DOUBLY` list iteration, in either direction.
+ *
+ * `_previous` is the node visited before `_current`, so the same step walks
+ * forward from the head or backward from the tail.
+ * @param iterator A pointer to the iterator.
+ * @return A pointer to the next element's value, or `NULL` if the end is reached or the iterator is invalid.
+ * @private
+ */
+void *doublyNext(TIterator iterator){
+    if (iterator == NULL || iterator->_current == NULL) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    Node current = iterator->_current;
+    iterator->_index++;
+    iterator->_current = xorLink(current->_nextNode, iterator->_previous);
+    iterator->_previous = current;
+    return current->_val;
+}
+
+/**
+ * @brief Appends the nodes of `src` in O(1), joining the two XOR links at the seam.
+ * @private
+ */
+void doublyConcat(ListHeader *this, ListHeader *src){
+    Node head = src->_head;
+    if (head == NULL) return;
+    Node tail = this->_tail;
+    if (tail == NULL) {
+        this->_head = head;
+    } else {
+        tail->_nextNode = xorLink(tail->_nextNode, head);
+        head->_nextNode = xorLink(head->_nextNode, tail);
+    }
+    this->_tail = src->_tail;
+    this->_length += src->_length;
+    src->_head = NULL;
+    src->_tail = NULL;
+    src->_length = 0;
+}
+
+/**
+ * @brief Detaches the nodes from `index` onwards into `suffix`, walking from the nearer end.
+ *
+ * `index` is strictly between 0 and the length.
+ * @private
+ */
+void doublySplitAt(ListHeader *this, int index, ListHeader *suffix){
+    Node prev, next;
+    Node last = locate(this, index - 1, &prev, &next);
+    last->_nextNode = xorLink(last->_nextNode, next);
+    next->_nextNode = xorLink(next->_nextNode, last);
+    suffix->_head = next;
+    suffix->_tail = this->_tail;
+    suffix->_length = this->_length - index;
+    this->_tail = last;
+    this->_length = index;
+}
+
+/**
+ * @brief Sorts the list by relinking its nodes.
+ *
+ * The XOR links are first turned into plain next links, the chain is sorted
+ * like a `LINKED` one, and the XOR links are rebuilt.
+ * @private
+ */
+void doublySort(ListHeader *this, const struct SortPlan *plan){
+    Node prev = NULL;
+    for (Node current = this->_head; current != NULL;){
+        Node next = xorLink(current->_nextNode, prev);
+        current->_nextNode = next;
+        prev = current;
+        current = next;
+    }
+    this->_head = sortNodes(this, this->_head, &this->_tail, plan);
+    prev = NULL;
+    for (Node current = this->_head; current != NULL;){
+        Node next = current->_nextNode;
+        current->_nextNode = xorLink(prev, next);
+        prev = current;
+        current = next;
+    }
+}
+
+/** @private */
+const struct ListOps doublyOps = {
+    push, doublyPop, doublyPrint, len, doublyDestroy, doublyGet, set, doublyDelete, insert, doublyPick, doublyForeach,
+    doublyPopBack, doublyPushValue, doublySetValue, doublyInsertValue, pushValues,
+    doublyConcat, doublySplitAt, doublySort, searchValues
+};
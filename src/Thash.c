@@ -0,0 +1,413 @@
+/**
+ * @file Thash.c
+ * @brief The optional hash index of a list, for O(1) membership tests.
+ *
+ * `enableHashIndex` switches a list to `hashedOps`, a table that wraps the
+ * operations of the list's layout. Every method that adds or removes elements
+ * updates an open-addressing hash table mapping each distinct value to the
+ * number of elements equal to it, then runs the layout's own operation. Lists
+ * without the index keep their layout's table and pay nothing.
+ *
+ * The index answers `contains` and `count` without touching the elements, and
+ * lets `indexOf` and `lastIndexOf` return -1 at once for absent values; they
+ * still scan for the position of a present one, since positions shift on every
+ * insertion and removal.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Hashes a byte string with 64-bit FNV-1a.
+ * @private
+ */
+static size_t hashBytes(const void *bytes, size_t length){
+    unsigned long long hash = 14695981039346656037ULL;
+    for (const unsigned char *c = bytes; c < (const unsigned char *)bytes + length; c++){
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return (size_t)hash;
+}
+
+/**
+ * @brief Mixes the bits of a 64-bit value, so that nearby numbers land far apart.
+ * @private
+ */
+static size_t hashBits(uint64_t bits){
+    bits ^= bits >> 30;
+    bits *= 0xBF58476D1CE4E5B9ULL;
+    bits ^= bits >> 27;
+    bits *= 0x94D049BB133111EBULL;
+    bits ^= bits >> 31;
+    return (size_t)bits;
+}
+
+/**
+ * @brief Reads a number or a `T` pointer into the bits it is indexed under.
+ *
+ * Values equal under `==` get the same bits: -0.0 is indexed as 0.0. NaN equals
+ * nothing and is not indexed at all.
+ * @return false for NaN.
+ * @private
+ */
+static bool keyBits(ListHeader *this, const void *val, uint64_t *bits){
+    *bits = 0;
+    if (this->_type == T) {
+        *bits = (uint64_t)(uintptr_t)val;
+    } else if (this->_type == FLOAT) {
+        float f = *(const float *)val;
+        if (f != f) return false;
+        if (f == 0) f = 0;
+        memcpy(bits, &f, sizeof(f));
+    } else if (this->_type == DOUBLE) {
+        double d = *(const double *)val;
+        if (d != d) return false;
+        if (d == 0) d = 0;
+        memcpy(bits, &d, sizeof(d));
+    } else {
+        memcpy(bits, val, this->_size);
+    }
+    return true;
+}
+
+/**
+ * @brief Tells whether the keys of a list are stored as copies rather than as bits.
+ * @private
+ */
+static bool copiedKeys(ListHeader *this){
+    return this->_type == STRING || this->_type == RECORD;
+}
+
+/**
+ * @brief Finds the entry for a value, or the empty entry where it would go.
+ * @return NULL when the value cannot be indexed (NaN, or a NULL string or record)
+ *         or the table is not allocated.
+ * @private
+ */
+static struct HashEntry *lookup(ListHeader *this, const void *val, size_t *hash){
+    struct HashIndex *index = this->_extras->_hashIndex;
+    uint64_t bits = 0;
+    if (copiedKeys(this) && val == NULL) {
+        return NULL;
+    } else if (copiedKeys(this)) {
+        *hash = hashBytes(val, this->_type == STRING ? strlen(val) : this->_size);
+    } else if (keyBits(this, val, &bits)) {
+        *hash = hashBits(bits);
+    } else {
+        return NULL;
+    }
+    if (index == NULL || index->_capacity == 0) return NULL;
+    size_t mask = index->_capacity - 1;
+    for (size_t i = *hash & mask; ; i = (i + 1) & mask){
+        struct HashEntry *entry = &index->_entries[i];
+        if (entry->_count == 0) return entry;
+        if (entry->_hash != *hash) continue;
+        if (this->_type == STRING ? strcmp(entry->_key._copy, val) == 0
+            : this->_type == RECORD ? memcmp(entry->_key._copy, val, this->_size) == 0
+            : entry->_key._bits == bits) {
+            return entry;
+        }
+    }
+}
+
+/**
+ * @brief Doubles the table, or allocates it, rehashing its entries.
+ * @private
+ */
+static void grow(ListHeader *this){
+    struct HashIndex *index = this->_extras->_hashIndex;
+    if (index == NULL) {
+        index = allocate(this, sizeof(struct HashIndex));
+        if (index == NULL) {
+            fprintf(stderr, "Error in enableHashIndex(): Failed to allocate the hash index.\n");
+            exit(EXIT_FAILURE);
+        }
+        memset(index, 0, sizeof(struct HashIndex));
+        this->_extras->_hashIndex = index;
+    }
+    size_t capacity = index->_capacity == 0 ? 64 : index->_capacity * 2;
+    struct HashEntry *entries = allocate(this, capacity * sizeof(struct HashEntry));
+    if (entries == NULL) {
+        fprintf(stderr, "Error in enableHashIndex(): Failed to grow the hash index to %zu entries.\n", capacity);
+        exit(EXIT_FAILURE);
+    }
+    memset(entries, 0, capacity * sizeof(struct HashEntry));
+    for (size_t i = 0; i < index->_capacity; i++){
+        struct HashEntry *entry = &index->_entries[i];
+        if (entry->_count == 0) continue;
+        size_t j = entry->_hash & (capacity - 1);
+        while (entries[j]._count != 0) j = (j + 1) & (capacity - 1);
+        entries[j] = *entry;
+    }
+    deallocate(this, index->_entries);
+    index->_entries = entries;
+    index->_capacity = capacity;
+}
+
+/**
+ * @brief Counts one more element equal to `val`.
+ * @param val The value, as `get` would return it.
+ * @private
+ */
+static void addKey(ListHeader *this, const void *val){
+    struct HashIndex *index = this->_extras->_hashIndex;
+    if (index == NULL || (index->_used + 1) * 2 > index->_capacity) grow(this);
+    size_t hash;
+    struct HashEntry *entry = lookup(this, val, &hash);
+    if (entry == NULL) return;
+    if (entry->_count++ > 0) return;
+    entry->_hash = hash;
+    if (this->_type == STRING) {
+        size_t length = strlen(val);
+        entry->_key._copy = allocate(this, length + 1);
+        if (entry->_key._copy != NULL) memcpy(entry->_key._copy, val, length + 1);
+    } else if (this->_type == RECORD) {
+        entry->_key._copy = allocate(this, this->_size);
+        if (entry->_key._copy != NULL) memcpy(entry->_key._copy, val, this->_size);
+    } else {
+        keyBits(this, val, &entry->_key._bits);
+    }
+    if (copiedKeys(this) && entry->_key._copy == NULL) {
+        fprintf(stderr, "Error in enableHashIndex(): Failed to allocate a hash index key.\n");
+        exit(EXIT_FAILURE);
+    }
+    this->_extras->_hashIndex->_used++;
+}
+
+/**
+ * @brief Counts one element equal to `val` less, dropping its entry at zero.
+ *
+ * The entries after it in its probe run are shifted back, so that the table
+ * needs no tombstones.
+ * @private
+ */
+static void removeKey(ListHeader *this, const void *val){
+    struct HashIndex *index = this->_extras->_hashIndex;
+    size_t hash;
+    struct HashEntry *entry = lookup(this, val, &hash);
+    if (entry == NULL || entry->_count == 0 || --entry->_count > 0) return;
+    if (copiedKeys(this)) deallocate(this, entry->_key._copy);
+    index->_used--;
+    size_t mask = index->_capacity - 1;
+    size_t hole = (size_t)(entry - index->_entries);
+    for (size_t i = (hole + 1) & mask; index->_entries[i]._count != 0; i = (i + 1) & mask){
+        size_t home = index->_entries[i]._hash & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            index->_entries[hole] = index->_entries[i];
+            index->_entries[i]._count = 0;
+            hole = i;
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of elements equal to `val`.
+ * @private
+ */
+static int keyCount(ListHeader *this, const void *val){
+    size_t hash;
+    struct HashEntry *entry = lookup(this, val, &hash);
+    return entry == NULL ? 0 : entry->_count;
+}
+
+/**
+ * @brief Frees the table and the keys it copied.
+ *
+ * Called through `releaseExtras`, which then switches the list back to its layout's operations.
+ * @private
+ */
+void releaseIndex(ListHeader *this){
+    struct HashIndex *index = this->_extras->_hashIndex;
+    if (index == NULL) return;
+    if (copiedKeys(this)) {
+        for (size_t i = 0; i < index->_capacity; i++){
+            if (index->_entries[i]._count != 0) deallocate(this, index->_entries[i]._key._copy);
+        }
+    }
+    deallocate(this, index->_entries);
+    deallocate(this, index);
+    this->_extras->_hashIndex = NULL;
+}
+
+/** @private */
+static void hashedPrint(ListHeader *this){
+    layoutOps(this->_layout)->print(this);
+}
+
+/**
+ * @brief Frees the elements; the layout's `free` then drops the index and turns it off.
+ * @private
+ */
+static void hashedFree(ListHeader *this){
+    layoutOps(this->_layout)->free(this);
+}
+
+/** @private */
+static void *hashedGet(ListHeader *this, int index){
+    return layoutOps(this->_layout)->get(this, index);
+}
+
+/** @private */
+static void *hashedPop(ListHeader *this){
+    int length = this->_length;
+    void *val = layoutOps(this->_layout)->pop(this);
+    if (this->_length < length) removeKey(this, val);
+    return val;
+}
+
+/** @private */
+static void *hashedPick(ListHeader *this, int index){
+    int length = this->_length;
+    void *val = layoutOps(this->_layout)->pick(this, index);
+    if (this->_length < length) removeKey(this, val);
+    return val;
+}
+
+/**
+ * @brief Uncounts an element while it is still stored, then lets the layout delete it in place.
+ *
+ * The element is never copied. `LINKED` lists are walked to the node before
+ * it, where the cursor lets their `remove` resume, so they are walked once.
+ * @private
+ */
+static void hashedRemove(ListHeader *this, int index){
+    const struct ListOps *ops = layoutOps(this->_layout);
+    if (this->_layout == LINKED && index > 0 && index < this->_length) {
+        ops->get(this, index - 1);
+        removeKey(this, this->_cursor->_nextNode->_val);
+    } else if (index >= 0 && index < this->_length) {
+        removeKey(this, ops->get(this, index));
+    }
+    ops->remove(this, index);
+}
+
+/**
+ * @brief Removes the last element by picking it; the generic `popBack` picks too.
+ * @private
+ */
+static void *hashedPopBack(ListHeader *this){
+    if (this->_length == 0) return NULL;
+    return hashedPick(this, this->_length - 1);
+}
+
+/** @private */
+static void hashedForeach(ListHeader *this, void(*function)(void*)){
+    layoutOps(this->_layout)->foreach(this, function);
+}
+
+/** @private */
+static void hashedPushValue(ListHeader *this, void *val){
+    addKey(this, val);
+    layoutOps(this->_layout)->_pushValue(this, val);
+}
+
+/**
+ * @brief Replaces an element, moving its count in the index to the new value.
+ *
+ * Numbers and records are overwritten through the pointer `get` returns, so
+ * the element is reached once; strings and `T` pointers are replaced by the
+ * layout, which owns their slots.
+ * @private
+ */
+static void hashedSetValue(ListHeader *this, int index, void *val){
+    const struct ListOps *ops = layoutOps(this->_layout);
+    if (index < 0 || index >= this->_length) {
+        ops->_setValue(this, index, val);
+        return;
+    }
+    void *slot = ops->get(this, index);
+    removeKey(this, slot);
+    addKey(this, val);
+    if (this->_type == STRING || this->_type == T) {
+        ops->_setValue(this, index, val);
+    } else {
+        memmove(slot, val, this->_size);
+    }
+}
+
+/** @private */
+static void hashedInsertValue(ListHeader *this, int index, void *val){
+    if (index >= 0 && index <= this->_length) addKey(this, val);
+    layoutOps(this->_layout)->_insertValue(this, index, val);
+}
+
+/**
+ * @brief Appends the values one at a time; hashing them costs more than the copy a bulk append saves.
+ * @private
+ */
+static void hashedPushValues(ListHeader *this, const unsigned char *src, size_t n){
+    for (size_t i = 0; i < n; i++){
+        hashedPushValue(this, slotValue(this, (unsigned char *)src + i * this->_size));
+    }
+}
+
+/** @copydoc unindexFrom */
+void unindexFrom(ListHeader *this, int index){
+    struct TIterator iterator;
+    startIterator(&iterator, this, this->_extras->_allocator);
+    advanceIterator(&iterator, index);
+    while (iterator.hasNext(&iterator)){
+        removeKey(this, iterator.next(&iterator));
+    }
+}
+
+/** @private */
+static void hashedSort(ListHeader *this, const struct SortPlan *plan){
+    layoutOps(this->_layout)->_sort(this, plan);
+}
+
+/**
+ * @brief Answers counts and membership from the index; scans only for the position of a present value.
+ * @private
+ */
+static int hashedFind(ListHeader *this, const struct SearchPlan *plan){
+    if (plan->compare != NULL) return layoutOps(this->_layout)->_find(this, plan);
+    int matches = keyCount(this, plan->key);
+    if (plan->mode == FIND_COUNT) return matches;
+    if (matches == 0) return -1;
+    if (plan->mode == FIND_ANY) return matches;
+    return layoutOps(this->_layout)->_find(this, plan);
+}
+
+/**
+ * @brief Operations of hash-indexed lists, of any layout.
+ *
+ * `concat` and `splitAt` never relink indexed lists, so `_concat` and `_splitAt`
+ * are the element by element moves they use, which go through the methods above.
+ * @private
+ */
+const struct ListOps hashedOps = {
+    push, hashedPop, hashedPrint, len, hashedFree, hashedGet, set, hashedRemove, insert, hashedPick, hashedForeach,
+    hashedPopBack, hashedPushValue, hashedSetValue, hashedInsertValue, hashedPushValues,
+    concatValues, splitValues, hashedSort, hashedFind
+};
+
+/**
+ * @brief Indexes the current elements of a list and switches it to `hashedOps`.
+ * @private
+ */
+static void indexList(ListHeader *this, const char *caller){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (this->ops == &hashedOps) return;
+    ownExtras(this);
+    struct TIterator iterator;
+    startIterator(&iterator, this, this->_extras->_allocator);
+    while (iterator.hasNext(&iterator)){
+        addKey(this, iterator.next(&iterator));
+    }
+    this->ops = &hashedOps;
+}
+
+/** @copydoc enableHashIndex */
+void enableHashIndex(List list){
+    indexList(headerOf(list), "enableHashIndex");
+}
+
+/** @copydoc enableHashIndexHeader */
+void enableHashIndexHeader(ListHeader *header){
+    indexList(header, "enableHashIndexHeader");
+}
@@ -0,0 +1,428 @@
+/**
+ * @file Tindexed.c
+ * @brief Implementation of the `INDEXED` list layout.
+ *
+ * An indexed list is a singly linked list whose nodes live in one growable
+ * pool, stored as two parallel arrays: `_links` holds the 32-bit index of each
+ * node's successor and `_values` holds its value inline. A node therefore costs
+ * four bytes plus the size of its value, with no per-node allocation and no
+ * pointers, so the pool can be copied or moved as a block. Removed nodes are
+ * chained on a free list through `_links` and reused by later insertions.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Returns the address of the value of node `node`.
+ * @private
+ */
+static unsigned char *slotAt(ListHeader *this, uint32_t node){
+    return this->_values + (size_t)node * this->_size;
+}
+
+/**
+ * @brief Doubles the pool, growing both arrays together.
+ * @private
+ */
+static void grow(ListHeader *this){
+    if (this->_slots >= (uint32_t)INT_MAX) {
+        fprintf(stderr, "Error in grow(): The node pool is full at %u nodes.\n", this->_slots);
+        exit(EXIT_FAILURE);
+    }
+    uint32_t slots = this->_slots == 0 ? INDEXED_INITIAL_CAPACITY : this->_slots * 2;
+    if (slots > (uint32_t)INT_MAX) slots = (uint32_t)INT_MAX;
+    uint32_t *links = reallocate(this, this->_links, (size_t)this->_slots * sizeof(uint32_t),
+                                 (size_t)slots * sizeof(uint32_t));
+    if (links == NULL) {
+        fprintf(stderr, "Error in grow(): Failed to grow the node pool to %u nodes.\n", slots);
+        exit(EXIT_FAILURE);
+    }
+    this->_links = links;
+    unsigned char *values = reallocate(this, this->_values, (size_t)this->_slots * this->_size,
+                                       (size_t)slots * this->_size);
+    if (values == NULL) {
+        fprintf(stderr, "Error in grow(): Failed to grow the node pool to %u nodes.\n", slots);
+        exit(EXIT_FAILURE);
+    }
+    this->_values = values;
+    this->_slots = slots;
+}
+
+/**
+ * @brief Takes a node from the free list, or the next unused slot of the pool.
+ * @private
+ */
+static uint32_t takeNode(ListHeader *this){
+    if (this->_vacant != INDEXED_NONE) {
+        uint32_t node = this->_vacant;
+        this->_vacant = this->_links[node];
+        return node;
+    }
+    if (this->_carved == this->_slots) grow(this);
+    return this->_carved++;
+}
+
+/**
+ * @brief Puts a node back on the free list.
+ * @private
+ */
+static void giveNode(ListHeader *this, uint32_t node){
+    this->_links[node] = this->_vacant;
+    this->_vacant = node;
+}
+
+/**
+ * @brief Returns the node at a position. The index must be in bounds.
+ * @private
+ */
+static uint32_t nodeAt(ListHeader *this, int index){
+    uint32_t node = this->_first;
+    for (int i = 0; i < index; i++){
+        node = this->_links[node];
+    }
+    return node;
+}
+
+/**
+ * @brief Unlinks the node at a position, without releasing it. The index must be in bounds.
+ * @private
+ */
+static uint32_t unlink(ListHeader *this, int index){
+    uint32_t node;
+    if (index == 0) {
+        node = this->_first;
+        this->_first = this->_links[node];
+        if (this->_first == INDEXED_NONE) this->_last = INDEXED_NONE;
+    } else {
+        uint32_t prev = nodeAt(this, index - 1);
+        node = this->_links[prev];
+        this->_links[prev] = this->_links[node];
+        if (node == this->_last) this->_last = prev;
+    }
+    this->_length--;
+    return node;
+}
+
+/**
+ * @brief Prints the contents of the list to standard output.
+ * @param this A pointer to the list.
+ * @private
+ */
+void indexedPrint(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
+        return;
+    }
+    printf("[");
+    for (uint32_t node = this->_first; node != INDEXED_NONE; node = this->_links[node]){
+        printValue(this, slotValue(this, slotAt(this, node)));
+        if (this->_links[node] != INDEXED_NONE){
+            printf(", ");
+        }
+    }
+    printf("]");
+    printf("\n");
+}
+
+/**
+ * @brief Frees the node pool and the strings it owns.
+ *
+ * As with the `LINKED` layout, pointers stored in a `T` list are not freed.
+ * This function does NOT free the `List` struct itself.
+ * @param this A pointer to the list.
+ * @private
+ */
+void indexedDestroy(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (this->_type == STRING && !this->_extras->_stringArena) {
+        for (uint32_t node = this->_first; node != INDEXED_NONE; node = this->_links[node]){
+            releaseSlot(this, slotAt(this, node));
+        }
+    }
+    releaseExtras(this);
+    deallocate(this, this->_links);
+    deallocate(this, this->_values);
+    this->_links = NULL;
+    this->_values = NULL;
+    this->_first = INDEXED_NONE;
+    this->_last = INDEXED_NONE;
+    this->_vacant = INDEXED_NONE;
+    this->_slots = 0;
+    this->_carved = 0;
+    this->_length = 0;
+}
+
+/**
+ * @brief Adds a new element to the end of the list.
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void indexedPushValue(ListHeader *this, void *val){
+    uint32_t node = takeNode(this);
+    storeValue(this, slotAt(this, node), val);
+    this->_links[node] = INDEXED_NONE;
+    if (this->_first == INDEXED_NONE) {
+        this->_first = node;
+    } else {
+        this->_links[this->_last] = node;
+    }
+    this->_last = node;
+    this->_length++;
+}
+
+/**
+ * @brief Removes the first element of the list and returns its value.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *indexedPop(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_length == 0) {
+        return NULL;
+    }
+    uint32_t node = unlink(this, 0);
+    void *val = takeSlot(this, slotAt(this, node));
+    giveNode(this, node);
+    return val;
+}
+
+/**
+ * @brief Retrieves a pointer to the element at a specific index.
+ *
+ * The returned pointer is invalidated by any operation that grows the pool.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to retrieve.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *indexedGet(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    return slotValue(this, slotAt(this, nodeAt(this, index)));
+}
+
+/**
+ * @brief Updates the value of an element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void indexedSetValue(ListHeader *this, int index, void *val){
+    if (index < 0) {
+        fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    unsigned char *slot = slotAt(this, nodeAt(this, index));
+    releaseSlot(this, slot);
+    storeValue(this, slot, val);
+}
+
+/**
+ * @brief Deletes the element at a specific index, freeing the string it owns.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to delete.
+ * @private
+ */
+void indexedDelete(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    uint32_t node = unlink(this, index);
+    releaseSlot(this, slotAt(this, node));
+    giveNode(this, node);
+}
+
+/**
+ * @brief Inserts a new element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void indexedInsertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
+    }
+    if (index == this->_length) {
+        indexedPushValue(this, val);
+        return;
+    }
+    uint32_t node = takeNode(this);
+    storeValue(this, slotAt(this, node), val);
+    if (index == 0) {
+        this->_links[node] = this->_first;
+        this->_first = node;
+    } else {
+        uint32_t prev = nodeAt(this, index - 1);
+        this->_links[node] = this->_links[prev];
+        this->_links[prev] = node;
+    }
+    this->_length++;
+}
+
+/**
+ * @brief Removes and returns the element at a specific index.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to remove.
+ * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *indexedPick(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    uint32_t node = unlink(this, index);
+    void *val = takeSlot(this, slotAt(this, node));
+    giveNode(this, node);
+    return val;
+}
+
+/**
+ * @brief Applies a given function to each element in the list.
+ * @param this A pointer to the list.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ * @private
+ */
+void indexedForeach(ListHeader *this, void(*function)(void*)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
+        return;
+    }
+    for (uint32_t node = this->_first; node != INDEXED_NONE; node = this->_links[node]){
+        function(slotValue(this, slotAt(this, node)));
+    }
+}
+
+/**
+ * @brief Returns the next element of an `INDEXED` list iteration.
+ * @param iterator A pointer to the iterator.
+ * @return A pointer to the next element's value, or `NULL` if the end is reached or the iterator is invalid.
+ * @private
+ */
+void *indexedNext(TIterator iterator){
+    if (iterator == NULL || iterator->_node == INDEXED_NONE) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    ListHeader *list = iterator->_list;
+    void *val = slotValue(list, slotAt(list, iterator->_node));
+    iterator->_index++;
+    iterator->_node = list->_links[iterator->_node];
+    return val;
+}
+
+/**
+ * @brief Checks if an `INDEXED` list iteration has more elements.
+ * @param iterator A pointer to the iterator.
+ * @return `true` if there is at least one more element to iterate over, `false` otherwise.
+ * @private
+ */
+bool indexedHasNext(TIterator iterator){
+    if (iterator == NULL) {
+        return false;
+    }
+    return iterator->_node != INDEXED_NONE;
+}
+
+/**
+ * @brief Copies the slots of every node, in list order, to or from a contiguous array.
+ * @private
+ */
+static void moveSlots(ListHeader *this, unsigned char *items, bool scatter){
+    for (uint32_t node = this->_first; node != INDEXED_NONE; node = this->_links[node]){
+        if (scatter) {
+            memcpy(slotAt(this, node), items, this->_size);
+        } else {
+            memcpy(items, slotAt(this, node), this->_size);
+        }
+        items += this->_size;
+    }
+}
+
+/**
+ * @brief Moves the elements from `index` onwards to `suffix` in one walk.
+ *
+ * Nodes cannot change pools, so the suffix's values are pushed onto `suffix`
+ * and its nodes go back on the free list; the prefix is not touched.
+ * @private
+ */
+void indexedSplitAt(ListHeader *this, int index, ListHeader *suffix){
+    uint32_t prev = index == 0 ? INDEXED_NONE : nodeAt(this, index - 1);
+    uint32_t node = index == 0 ? this->_first : this->_links[prev];
+    while (node != INDEXED_NONE){
+        uint32_t next = this->_links[node];
+        suffix->ops->_pushValue(suffix, slotValue(this, slotAt(this, node)));
+        releaseSlot(this, slotAt(this, node));
+        giveNode(this, node);
+        node = next;
+    }
+    if (index == 0) {
+        this->_first = INDEXED_NONE;
+    } else {
+        this->_links[prev] = INDEXED_NONE;
+    }
+    this->_last = prev;
+    this->_length = index;
+}
+
+/**
+ * @brief Sorts the list, moving the values between the nodes' slots.
+ * @private
+ */
+void indexedSort(ListHeader *this, const struct SortPlan *plan){
+    sortGathered(this, plan, moveSlots);
+}
+
+/** @private */
+const struct ListOps indexedOps = {
+    push, indexedPop, indexedPrint, len, indexedDestroy, indexedGet, set, indexedDelete, insert, indexedPick, indexedForeach,
+    popBack, indexedPushValue, indexedSetValue, indexedInsertValue, pushValues,
+    concatValues, indexedSplitAt, indexedSort, searchValues
+};
@@ -1,12 +1,102 @@
 #include "Tlist.h"
 #include "TlistPrivate.h"
 
+/**
+ * @brief Allocates an iterator positioned at the first element of a list.
+ * @private
+ */
+static TIterator allocIterator(ListHeader *header, const char *caller){
+    if (header == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        exit(EXIT_FAILURE);
+    }
+    const ListAllocator *allocator = header->_extras->_allocator;
+    TIterator iterator = allocator == NULL ? malloc(sizeof(struct TIterator))
+                                           : allocator->malloc(allocator->context, sizeof(struct TIterator));
+    if(iterator == NULL) {
+        fprintf(stderr, "Error in %s(): Failed to allocate memory for the new iterator.\n", caller);
+        exit(EXIT_FAILURE);
+    }
+    startIterator(iterator, header, allocator);
+    return iterator;
+}
+
+/** @copydoc startIterator */
+void startIterator(TIterator iterator, ListHeader *header, const ListAllocator *allocator){
+    iterator->_list = header;
+    iterator->_allocator = allocator;
+    iterator->_current = NULL;
+    iterator->_previous = NULL;
+    iterator->_chunk = NULL;
+    iterator->_slot = 0;
+    iterator->_node = INDEXED_NONE;
+    iterator->_skip = NULL;
+    iterator->_leaf = NULL;
+    iterator->_index = 0;
+    iterator->_remaining = 0;
+    iterator->_step = NULL;
+    iterator->free = freeIterator;
+    if (header->_layout == UNROLLED) {
+        iterator->_chunk = header->_firstChunk;
+        iterator->next = unrolledNext;
+        iterator->hasNext = unrolledHasNext;
+    } else if (header->_layout == ARRAY) {
+        iterator->next = arrayNext;
+        iterator->hasNext = arrayHasNext;
+    } else if (header->_layout == INDEXED) {
+        iterator->_node = header->_first;
+        iterator->next = indexedNext;
+        iterator->hasNext = indexedHasNext;
+    } else if (header->_layout == SKIPLIST) {
+        iterator->_skip = header->_skipHead == NULL ? NULL : header->_skipHead->_links[0]._next;
+        iterator->next = skiplistNext;
+        iterator->hasNext = skiplistHasNext;
+    } else if (header->_layout == ROPE) {
+        iterator->next = ropeNext;
+        iterator->hasNext = ropeHasNext;
+    } else if (header->_layout == DOUBLY) {
+        iterator->_current = header->_head;
+        iterator->next = doublyNext;
+        iterator->hasNext = hasNext;
+    } else {
+        iterator->_current = header->_head;
+        iterator->next = next;
+        iterator->hasNext = hasNext;
+    }
+}
+
+/** @copydoc advanceIterator */
+void advanceIterator(TIterator iterator, int steps){
+    if (steps <= 0) return;
+    ListHeader *header = iterator->_list;
+    if (header->_layout == ARRAY || header->_layout == ROPE) {
+        iterator->_index += steps;
+        iterator->_leaf = NULL;
+    } else if (header->_layout == SKIPLIST) {
+        iterator->_index += steps;
+        iterator->_skip = iterator->_index < header->_length ? skiplistNodeAt(header, iterator->_index) : NULL;
+    } else if (header->_layout == UNROLLED) {
+        iterator->_index += steps;
+        steps += iterator->_slot;
+        while (iterator->_chunk != NULL && steps >= iterator->_chunk->_count){
+            steps -= iterator->_chunk->_count;
+            iterator->_chunk = iterator->_chunk->_next;
+        }
+        iterator->_slot = steps;
+    } else {
+        for (int i = 0; i < steps; i++){
+            iterator->next(iterator);
+        }
+    }
+}
+
 /**
  * @brief Creates a new iterator for the given list.
  *
  * The iterator allows sequential access to the elements of the list.
  * It starts at the head of the list. The caller is responsible for freeing
  * the iterator using `iterator->free(iterator)` when it is no longer needed.
+ * Lists created with `newListWith` allocate their iterators with their allocator.
  *
  * @param list The list to iterate over. Must not be NULL.
  * @return A pointer to the newly created iterator.
@@ -14,24 +104,40 @@
  *          the program will exit with `EXIT_FAILURE`.
  */
 TIterator newIterator(List list){
-    TIterator iterator = malloc(sizeof(struct TIterator));
-    if(iterator == NULL) {
-        fprintf(stderr, "Error in newIterator(): Failed to allocate memory for the new iterator.\n");
-        exit(EXIT_FAILURE);
-    }
-    if (list == NULL) {
-        fprintf(stderr, "Error in newIterator(): The provided list instance is NULL.\n");
-        exit(EXIT_FAILURE);
+    return allocIterator(headerOf(list), "newIterator");
+}
+
+/** @copydoc newIteratorHeader */
+TIterator newIteratorHeader(ListHeader *header){
+    return allocIterator(header, "newIteratorHeader");
+}
+
+/**
+ * @brief Allocates an iterator positioned at the last element of a `DOUBLY` list.
+ * @private
+ */
+static TIterator allocReverseIterator(ListHeader *header, const char *caller){
+    if (header != NULL && header->_layout != DOUBLY) {
+        fprintf(stderr, "Error in %s(): Only DOUBLY lists can be iterated backwards.\n", caller);
+        return NULL;
     }
-    iterator->_list = list;
-    iterator->_current = list->_head;
-    iterator->_index = 0;
-    iterator->next = next;
+    TIterator iterator = allocIterator(header, caller);
+    iterator->_current = iterator->_list->_tail;
+    iterator->next = doublyNext;
     iterator->hasNext = hasNext;
-    iterator->free = freeIterator;
     return iterator;
 }
 
+/** @copydoc newReverseIterator */
+TIterator newReverseIterator(List list){
+    return allocReverseIterator(headerOf(list), "newReverseIterator");
+}
+
+/** @copydoc newReverseIteratorHeader */
+TIterator newReverseIteratorHeader(ListHeader *header){
+    return allocReverseIterator(header, "newReverseIteratorHeader");
+}
+
 /**
  * @brief Returns the next element in the iteration.
  *
@@ -66,9 +172,14 @@ bool hasNext(TIterator iterator){
 /**
  * @brief Frees the memory allocated for the iterator structure.
  *
- * This function does not affect the list that the iterator was created from.
+ * This function does not affect the list that the iterator was created from,
+ * which may already have been freed.
  * @param iterator A pointer to the iterator to be freed.
  */
 void freeIterator(TIterator iterator){
+    if (iterator != NULL && iterator->_allocator != NULL) {
+        iterator->_allocator->free(iterator->_allocator->context, iterator);
+        return;
+    }
     free(iterator);
 }
\ No newline at end of file
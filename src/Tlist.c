@@ -15,6 +15,8 @@
  *   - `INT`: Stores copies of integer values.
  *   - `FLOAT`: Stores copies of floating-point values.
  *   - `DOUBLE`: Stores copies of double-precision floating-point values.
+ *   - `INT8` to `INT64`, `UINT8` to `UINT64`: Store copies of fixed-width integers at their natural size.
+ *   - `RECORD`: Stores copies of fixed-size structs (see `newRecordList`).
  *   - `STRING`: Stores copies of C strings (char*).
  *   - `T`: Stores generic pointers (`void*`), leaving memory management of the data to the user.
  * - **Object-Oriented Interface:** Interact with the list through its methods, such as `list->push(list, data)`.
@@ -59,31 +61,91 @@
 #include "Tlist.h"
 #include "TlistPrivate.h"
 
+static void bindMethods(struct Lista *this);
 
 /** @copydoc newList */
 List newList(Type type){
+    return newListOf(type, LINKED);
+}
+
+/** @copydoc newListOf */
+List newListOf(Type type, Layout layout){
+    if (type == RECORD) {
+        fprintf(stderr, "Error in newListOf(): RECORD lists need a record size; use newRecordList().\n");
+        return NULL;
+    }
     List this = (List)malloc(sizeof(struct Lista));
     if(this == NULL) {
-        fprintf(stderr, "Error in newList(): Failed to allocate memory for the new list.\n");
+        fprintf(stderr, "Error in newListOf(): Failed to allocate memory for the new list.\n");
         exit(EXIT_FAILURE);
     }
-    this->_head = NULL;
-    this->_tail = NULL;
-    this->_type = type;
-    this->_length = 0;
+    initList(this, type, layout);
+    return this;
+}
+
+/** @copydoc newRecordList */
+List newRecordList(size_t recordSize, Layout layout){
+    if (recordSize == 0) {
+        fprintf(stderr, "Error in newRecordList(): The record size must be greater than zero.\n");
+        return NULL;
+    }
+    List this = (List)malloc(sizeof(struct Lista));
+    if(this == NULL) {
+        fprintf(stderr, "Error in newRecordList(): Failed to allocate memory for the new list.\n");
+        exit(EXIT_FAILURE);
+    }
+    initHeader(&this->_header, RECORD, recordSize, layout);
+    bindMethods(this);
+    return this;
+}
+
+/** @copydoc initListHeader */
+bool initListHeader(ListHeader *this, Type type, Layout layout){
+    if (type == RECORD) {
+        fprintf(stderr, "Error in initListHeader(): RECORD lists need a record size; use initRecordListHeader().\n");
+        return false;
+    }
+    initHeader(this, type, 0, layout);
+    return true;
+}
+
+/** @copydoc initRecordListHeader */
+bool initRecordListHeader(ListHeader *this, size_t recordSize, Layout layout){
+    if (recordSize == 0) {
+        fprintf(stderr, "Error in initRecordListHeader(): The record size must be greater than zero.\n");
+        return false;
+    }
+    initHeader(this, RECORD, recordSize, layout);
+    return true;
+}
 
-    // list methods
-    this->print = print;
-    this->free = destroyList;
-    this->push = push;
-    this->pop = pop;
-    this->len = len;
-    this->get = get;
-    this->set = set;
-    this->remove = delete;
-    this->insert = insert;
-    this->pick = pick;
-    this->foreach = foreach;
+/** @copydoc layoutOps */
+const struct ListOps *layoutOps(Layout layout){
+    switch(layout){
+        case UNROLLED: return &unrolledOps;
+        case ARRAY:    return &arrayOps;
+        case INDEXED:  return &indexedOps;
+        case DOUBLY:   return &doublyOps;
+        case SKIPLIST: return &skiplistOps;
+        case ROPE:     return &ropeOps;
+        default:       return &linkedOps;
+    }
+}
+
+/**
+ * @brief Initializes a list header, with the element size of `RECORD` lists.
+ * @param this The header to initialize.
+ * @param type The data type the list will hold.
+ * @param recordSize The size of a `RECORD` element, checked non-zero by the
+ *        public constructors; ignored for the other types.
+ * @param layout The storage layout.
+ * @private
+ */
+void initHeader(ListHeader *this, Type type, size_t recordSize, Layout layout){
+    memset(this, 0, sizeof(ListHeader));
+    this->_extras = (struct ListExtras *)&noExtras;
+    this->_type = type;
+    this->_layout = layout;
 
     switch(type){
         case INT:
@@ -101,86 +163,654 @@ List newList(Type type){
         case T:
             this->_size = sizeof(void *);
             break;
+        case INT8:
+        case UINT8:
+            this->_size = 1;
+            break;
+        case INT16:
+        case UINT16:
+            this->_size = 2;
+            break;
+        case INT32:
+        case UINT32:
+            this->_size = 4;
+            break;
+        case INT64:
+        case UINT64:
+            this->_size = 8;
+            break;
+        case RECORD:
+            this->_size = recordSize;
+            break;
     }
 
-    return this;
+    switch(layout){
+        case UNROLLED:
+            this->_chunkCapacity = this->_size < UNROLLED_CHUNK_BYTES ? UNROLLED_CHUNK_BYTES / (int)this->_size : 1;
+            break;
+        case INDEXED:
+            this->_first = INDEXED_NONE;
+            this->_last = INDEXED_NONE;
+            this->_vacant = INDEXED_NONE;
+            break;
+        case SKIPLIST:
+            this->_skipSeed = 0x9E3779B9u;
+            break;
+        case ROPE:
+            this->_ropeCapacity = this->_size < ROPE_CHUNK_BYTES ? ROPE_CHUNK_BYTES / (int)this->_size : 1;
+            this->_ropeSeed = 0x9E3779B9u;
+            break;
+        default:
+            break;
+    }
+    this->ops = layoutOps(layout);
+}
+
+/** @copydoc destroyListHeader */
+void destroyListHeader(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyListHeader(): The provided list header is NULL.\n");
+        return;
+    }
+    this->ops->free(this);
+}
+
+/**
+ * @brief Reports a method called on a NULL list.
+ * @private
+ * @return Always `true`, so it can be used as `if (this == NULL && nullList("pop"))`.
+ */
+static bool nullList(const char *method){
+    fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", method);
+    return true;
+}
+
+/** @private */
+static void listPush(List this, ...){
+    if (this == NULL && nullList("push")) return;
+    this->_header._version++;
+    va_list args;
+    va_start(args, this);
+    Scalar buf;
+    this->_header.ops->_pushValue(&this->_header, readValue(&this->_header, &args, &buf));
+    va_end(args);
+}
+
+/** @private */
+static void listSet(List this, int index, ...){
+    if (this == NULL && nullList("set")) return;
+    va_list args;
+    va_start(args, index);
+    Scalar buf;
+    this->_header.ops->_setValue(&this->_header, index, readValue(&this->_header, &args, &buf));
+    va_end(args);
+}
+
+/** @private */
+static void listInsert(List this, int index, ...){
+    if (this == NULL && nullList("insert")) return;
+    this->_header._version++;
+    va_list args;
+    va_start(args, index);
+    Scalar buf;
+    this->_header.ops->_insertValue(&this->_header, index, readValue(&this->_header, &args, &buf));
+    va_end(args);
+}
+
+/** @private */
+static void *listPop(List this){
+    if (this == NULL && nullList("pop")) return NULL;
+    this->_header._version++;
+    return this->_header.ops->pop(&this->_header);
+}
+
+/** @private */
+static void listPrint(List this){
+    if (this == NULL && nullList("print")) return;
+    this->_header.ops->print(&this->_header);
+}
+
+/** @private */
+static int listLen(List this){
+    if (this == NULL && nullList("len")) return 0;
+    return this->_header._length;
+}
+
+/** @private */
+static void listFree(List this){
+    if (this == NULL && nullList("destroyList")) return;
+    this->_header._version++;
+    this->_header.ops->free(&this->_header);
+}
+
+/** @private */
+static void *listGet(List this, int index){
+    if (this == NULL && nullList("get")) return NULL;
+    return this->_header.ops->get(&this->_header, index);
+}
+
+/** @private */
+static void listRemove(List this, int index){
+    if (this == NULL && nullList("delete")) return;
+    this->_header._version++;
+    this->_header.ops->remove(&this->_header, index);
+}
+
+/** @private */
+static void *listPick(List this, int index){
+    if (this == NULL && nullList("pick")) return NULL;
+    this->_header._version++;
+    return this->_header.ops->pick(&this->_header, index);
+}
+
+/** @private */
+static void listForeach(List this, void(*function)(void*)){
+    if (this == NULL && nullList("foreach")) return;
+    this->_header.ops->foreach(&this->_header, function);
+}
+
+/** @private */
+static void *listPopBack(List this){
+    if (this == NULL && nullList("popBack")) return NULL;
+    this->_header._version++;
+    return this->_header.ops->popBack(&this->_header);
+}
+
+/**
+ * @brief Points the methods of a list at the wrappers that forward to its operations table.
+ *
+ * The wrappers of the methods that add or remove elements also bump `_version`,
+ * which invalidates the list's slices.
+ * @private
+ */
+static void bindMethods(struct Lista *this){
+    this->print = listPrint;
+    this->free = listFree;
+    this->push = listPush;
+    this->pop = listPop;
+    this->len = listLen;
+    this->get = listGet;
+    this->set = listSet;
+    this->remove = listRemove;
+    this->insert = listInsert;
+    this->pick = listPick;
+    this->foreach = listForeach;
+    this->popBack = listPopBack;
+}
+
+/** @copydoc initList */
+bool initList(struct Lista *this, Type type, Layout layout){
+    if (type == RECORD) {
+        fprintf(stderr, "Error in initList(): RECORD lists need a record size; use initRecordList().\n");
+        return false;
+    }
+    initHeader(&this->_header, type, 0, layout);
+    bindMethods(this);
+    return true;
+}
+
+/** @copydoc initRecordList */
+bool initRecordList(struct Lista *this, size_t recordSize, Layout layout){
+    if (recordSize == 0) {
+        fprintf(stderr, "Error in initRecordList(): The record size must be greater than zero.\n");
+        return false;
+    }
+    initHeader(&this->_header, RECORD, recordSize, layout);
+    bindMethods(this);
+    return true;
+}
+
+/**
+ * @brief Reads the next variadic argument as a value of the list's type.
+ *
+ * Applies the default argument promotions in reverse: `INT` and the 8 and 16-bit
+ * types are read as `int`, `FLOAT` and `DOUBLE` as `double`, the 32 and 64-bit
+ * types at their own width, and `STRING`, `T` and `RECORD` as pointers.
+ * @param this A pointer to the list.
+ * @param args The argument list positioned at the value.
+ * @param buf Storage for scalar values.
+ * @return A pointer to the value: into `buf` for scalars, or the passed pointer itself
+ *         for `STRING`, `T` and `RECORD`.
+ * @private
+ */
+void *readValue(ListHeader *this, va_list *args, Scalar *buf){
+    switch (this->_type){
+        case INT:
+            buf->_int = va_arg(*args, int);
+            return &buf->_int;
+        case FLOAT:
+            buf->_float = (float)va_arg(*args, double);
+            return &buf->_float;
+        case DOUBLE:
+            buf->_double = va_arg(*args, double);
+            return &buf->_double;
+        case INT8:
+            buf->_int8 = (int8_t)va_arg(*args, int);
+            return &buf->_int8;
+        case INT16:
+            buf->_int16 = (int16_t)va_arg(*args, int);
+            return &buf->_int16;
+        case INT32:
+            buf->_int32 = va_arg(*args, int32_t);
+            return &buf->_int32;
+        case INT64:
+            buf->_int64 = va_arg(*args, int64_t);
+            return &buf->_int64;
+        case UINT8:
+            buf->_uint8 = (uint8_t)va_arg(*args, int);
+            return &buf->_uint8;
+        case UINT16:
+            buf->_uint16 = (uint16_t)va_arg(*args, int);
+            return &buf->_uint16;
+        case UINT32:
+            buf->_uint32 = va_arg(*args, uint32_t);
+            return &buf->_uint32;
+        case UINT64:
+            buf->_uint64 = va_arg(*args, uint64_t);
+            return &buf->_uint64;
+        default:
+            return va_arg(*args, void *);
+    }
+}
+
+/**
+ * @brief Returns the value held by an element slot, as `get` exposes it.
+ *
+ * Slots are the `_size`-byte element cells used by the contiguous layouts.
+ *
+ * For value types this is the slot itself; for `STRING` and `T` it is the stored pointer.
+ * @param this A pointer to the list.
+ * @param slot The slot to read.
+ * @return A pointer to the value.
+ * @private
+ */
+void *slotValue(ListHeader *this, unsigned char *slot){
+    if (this->_type == STRING || this->_type == T) {
+        void *val;
+        memcpy(&val, slot, sizeof(void *));
+        return val;
+    }
+    return slot;
+}
+
+/**
+ * @brief Stores a value into a slot, copying strings.
+ * @private
+ */
+void storeValue(ListHeader *this, unsigned char *slot, void *val){
+    if (this->_type == STRING) {
+        if (val == NULL) {
+            fprintf(stderr, "Error in storeValue(): Cannot store a NULL pointer in a STRING list.\n");
+            exit(EXIT_FAILURE);
+        }
+        char *copy = copyString(this, val);
+        memcpy(slot, &copy, sizeof(char *));
+    } else if (this->_type == T) {
+        memcpy(slot, &val, sizeof(void *));
+    } else {
+        if (this->_type == RECORD && val == NULL) {
+            fprintf(stderr, "Error in storeValue(): Cannot store a NULL pointer in a RECORD list.\n");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(slot, val, this->_size);
+    }
+}
+
+/**
+ * @brief Releases the memory a slot owns (only strings own memory).
+ * @private
+ */
+void releaseSlot(ListHeader *this, unsigned char *slot){
+    if (this->_type == STRING) releaseString(this, slotValue(this, slot));
+}
+
+/**
+ * @brief Hands the value of a slot over to the caller, as `pop` and `pick` return it.
+ * @private
+ */
+void *takeSlot(ListHeader *this, unsigned char *slot){
+    if (this->_type == T || (this->_type == STRING && mallocStrings(this))) {
+        return slotValue(this, slot);
+    }
+    size_t size = this->_type == STRING ? strlen(slotValue(this, slot)) + 1 : this->_size;
+    void *val = malloc(size);
+    if (val == NULL) {
+        fprintf(stderr, "Error in takeSlot(): Failed to allocate memory for the returned value.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(val, slotValue(this, slot), size);
+    if (this->_type == STRING) releaseString(this, slotValue(this, slot));
+    return val;
+}
+
+/**
+ * @brief Prints a single value of the list's type to stdout.
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as returned by `get`.
+ * @private
+ */
+void printValue(ListHeader *this, void *val){
+    switch (this->_type){
+        case INT:
+            printf("%d", *(int *)val);
+            break;
+        case STRING:
+            printf("\"%s\"", (char *)val);
+            break;
+        case DOUBLE:
+            printf("%.2f", *(double *)val);
+            break;
+        case FLOAT:
+            printf("%.2f", *(float *)val);
+            break;
+        case T:
+            printf("%p", val);
+            break;
+        case INT8:
+            printf("%" PRId8, *(int8_t *)val);
+            break;
+        case INT16:
+            printf("%" PRId16, *(int16_t *)val);
+            break;
+        case INT32:
+            printf("%" PRId32, *(int32_t *)val);
+            break;
+        case INT64:
+            printf("%" PRId64, *(int64_t *)val);
+            break;
+        case UINT8:
+            printf("%" PRIu8, *(uint8_t *)val);
+            break;
+        case UINT16:
+            printf("%" PRIu16, *(uint16_t *)val);
+            break;
+        case UINT32:
+            printf("%" PRIu32, *(uint32_t *)val);
+            break;
+        case UINT64:
+            printf("%" PRIu64, *(uint64_t *)val);
+            break;
+        case RECORD:
+            printf("{");
+            for (size_t i = 0; i < this->_size; i++){
+                printf(i == 0 ? "%02x" : " %02x", ((unsigned char *)val)[i]);
+            }
+            printf("}");
+            break;
+    }
 }
 
 /**
- * @brief Creates a new list node and allocates memory for its value.
+ * @brief Attaches a node pool to an empty list.
  *
- * For `INT`, `FLOAT`, and `DOUBLE`, it allocates `size` bytes and copies the value.
- * For `STRING`, it allocates memory for a new string and copies the content.
+ * The pool is only set up here; the first slab is allocated on the first insertion.
+ * @param this A pointer to the list.
+ * @param caller The public function to name in error messages.
+ * @param nodesPerSlab Number of nodes per slab, or 0 for `DEFAULT_SLAB_NODES`.
+ * @private
+ */
+static void poolNodes(ListHeader *this, const char *caller, size_t nodesPerSlab){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (this->_layout != LINKED && this->_layout != DOUBLY) {
+        fprintf(stderr, "Error in %s(): The node pool is only available for LINKED and DOUBLY lists.\n", caller);
+        return;
+    }
+    if (this->_head != NULL) {
+        fprintf(stderr, "Error in %s(): The pool can only be enabled on an empty list.\n", caller);
+        return;
+    }
+    if (this->_extras->_intrusive) {
+        fprintf(stderr, "Error in %s(): Intrusive lists do not allocate nodes.\n", caller);
+        return;
+    }
+    ownExtras(this)->_slabNodes = nodesPerSlab == 0 ? DEFAULT_SLAB_NODES : nodesPerSlab;
+}
+
+/** @copydoc enableNodePool */
+void enableNodePool(List list, size_t nodesPerSlab){
+    poolNodes(headerOf(list), "enableNodePool", nodesPerSlab);
+}
+
+/** @copydoc enableNodePoolHeader */
+void enableNodePoolHeader(ListHeader *header, size_t nodesPerSlab){
+    poolNodes(header, "enableNodePoolHeader", nodesPerSlab);
+}
+
+/**
+ * @brief Makes an empty `T` list link its elements through an embedded `ListLink`.
+ * @param this A pointer to the list.
+ * @param caller The public function to name in error messages.
+ * @param linkOffset Offset of the `ListLink` inside the element struct.
+ * @private
+ */
+static void linkIntrusively(ListHeader *this, const char *caller, size_t linkOffset){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (this->_type != T || this->_layout != LINKED) {
+        fprintf(stderr, "Error in %s(): Intrusive mode is only available for LINKED lists of type T.\n", caller);
+        return;
+    }
+    if (this->_head != NULL) {
+        fprintf(stderr, "Error in %s(): Intrusive mode can only be enabled on an empty list.\n", caller);
+        return;
+    }
+    if (this->_extras->_slabNodes != 0) {
+        fprintf(stderr, "Error in %s(): Intrusive lists cannot use a node pool.\n", caller);
+        return;
+    }
+    struct ListExtras *extras = ownExtras(this);
+    extras->_intrusive = true;
+    extras->_linkOffset = linkOffset;
+}
+
+/** @copydoc enableIntrusive */
+void enableIntrusive(List list, size_t linkOffset){
+    linkIntrusively(headerOf(list), "enableIntrusive", linkOffset);
+}
+
+/** @copydoc enableIntrusiveHeader */
+void enableIntrusiveHeader(ListHeader *header, size_t linkOffset){
+    linkIntrusively(header, "enableIntrusiveHeader", linkOffset);
+}
+
+/**
+ * @brief Returns the number of bytes a node of this list occupies.
+ *
+ * Value types add their inline storage to the node header, and `STRING` nodes
+ * add `SSO_CAPACITY` bytes for short strings unless the list uses a string arena. The result is rounded
+ * up to `max_align_t` alignment so that nodes laid out back to back in a slab
+ * keep their inline values aligned for any element type.
+ * @param this A pointer to the list.
+ * @return The node size in bytes.
+ * @private
+ */
+size_t nodeSize(ListHeader *this){
+    size_t size = sizeof(struct Node);
+    if (this->_type == STRING && !this->_extras->_stringArena) size += SSO_CAPACITY;
+    else if (this->_type != T) size += this->_size;
+    return (size + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1);
+}
+
+/**
+ * @brief Allocates the memory for one node.
+ *
+ * Without a pool this is a plain `malloc`. With a pool, a recycled node is reused
+ * if there is one; otherwise the next free slot of the newest slab is taken,
+ * allocating a new slab when the current one is exhausted.
+ * @param this A pointer to the list.
+ * @return Uninitialized memory for a node.
+ * @private
+ */
+static Node allocNode(ListHeader *this){
+    struct ListExtras *pool = this->_extras;
+    if (pool->_slabNodes == 0) {
+        Node node = (Node)allocate(this, nodeSize(this));
+        if(node == NULL) {
+            fprintf(stderr, "Error in newNode(): Failed to allocate memory for a new node.\n");
+            exit(EXIT_FAILURE);
+        }
+        return node;
+    }
+    if (pool->_freeNodes != NULL) {
+        Node node = pool->_freeNodes;
+        pool->_freeNodes = node->_nextNode;
+        return node;
+    }
+    size_t size = nodeSize(this);
+    if (pool->_slabs == NULL || pool->_slabUsed == pool->_slabNodes) {
+        struct Slab *slab = allocate(this, sizeof(struct Slab) + size * pool->_slabNodes);
+        if (slab == NULL) {
+            fprintf(stderr, "Error in newNode(): Failed to allocate memory for a new node slab.\n");
+            exit(EXIT_FAILURE);
+        }
+        slab->_next = pool->_slabs;
+        pool->_slabs = slab;
+        pool->_slabUsed = 0;
+    }
+    return (Node)(pool->_slabs->_nodes + size * pool->_slabUsed++);
+}
+
+/**
+ * @brief Returns the memory of a node to the pool, or to the system without one.
+ * @param this A pointer to the list.
+ * @param node The node to recycle. Its value must already have been released.
+ * @private
+ */
+static void recycleNode(ListHeader *this, Node node){
+    struct ListExtras *pool = this->_extras;
+    if (pool->_intrusive) return;
+    if (pool->_slabNodes == 0) {
+        deallocate(this, node);
+        return;
+    }
+    node->_nextNode = pool->_freeNodes;
+    pool->_freeNodes = node;
+}
+
+/**
+ * @brief Stores a string in a `STRING` node, inline when it fits.
+ *
+ * Lists with a string arena always store the string in the arena.
+ * Any string the node previously owned must already have been released.
+ * @param this The list the node belongs to.
+ * @param node The node to store into.
+ * @param str The string to copy.
+ * @private
+ */
+static void storeString(ListHeader *this, Node node, const char *str){
+    size_t length = strlen(str);
+    if (length < SSO_CAPACITY && !this->_extras->_stringArena) {
+        node->_val = memcpy(node->_data, str, length + 1);
+    } else {
+        node->_val = copyString(this, str);
+    }
+}
+
+/**
+ * @brief Creates a new list node and stores its value.
+ *
+ * For `INT`, `FLOAT`, and `DOUBLE`, the node is allocated with `size` extra bytes
+ * and the value is copied into them, so no second allocation is needed.
+ * For `STRING`, strings shorter than `SSO_CAPACITY` are copied into the node;
+ * longer ones get a separate heap copy.
  * For `T`, it does not allocate memory for the value but stores the pointer `val` directly.
+ * Intrusive lists use the `ListLink` embedded in `val` as the node and allocate nothing.
  *
+ * @param this The list the node will belong to.
  * @param val A pointer to the value to be stored in the node.
- * @param size The size of the data type (for value types).
- * @param type The `Type` of the data.
  * @return A pointer to the newly created `Node`.
  * @private
  */
-Node newNode(void *val, size_t size, Type type){
-    Node node = (Node)malloc(sizeof(struct Node));    
-    if(node == NULL) {
-        fprintf(stderr, "Error in newNode(): Failed to allocate memory for a new node.\n");
+Node newNode(ListHeader *this, void *val){
+    if ((this->_type == STRING || this->_type == RECORD) && val == NULL) {
+        fprintf(stderr, "Error in newNode(): Cannot create a %s node from a NULL pointer.\n",
+                this->_type == STRING ? "STRING" : "RECORD");
         exit(EXIT_FAILURE);
     }
-    if (type == STRING) {
+    if (this->_extras->_intrusive) {
         if (val == NULL) {
-            fprintf(stderr, "Error in newNode(): Cannot create a STRING node from a NULL pointer.\n");
-            exit(EXIT_FAILURE);
-        }
-        node->_val = malloc(strlen((char *)val) + 1);
-        if (node->_val == NULL) {
-            fprintf(stderr, "Error in newNode(): Failed to allocate memory for the node's string value.\n");
+            fprintf(stderr, "Error in newNode(): Cannot link a NULL element into an intrusive list.\n");
             exit(EXIT_FAILURE);
         }
-        strcpy((char *)node->_val, (char *)val);
+        Node node = (Node)((unsigned char *)val + this->_extras->_linkOffset);
+        node->_val = val;
+        node->_nextNode = NULL;
+        return node;
+    }
+    Node node = allocNode(this);
+    if (this->_type == STRING) {
+        storeString(this, node, val);
     }
-    else if (type == T) {
+    else if (this->_type == T) {
         node->_val = val;
     }
     else {
-        node->_val = malloc(size);
-        if (node->_val == NULL) {
-            fprintf(stderr, "Error in newNode(): Failed to allocate memory for the node's value.\n");
-            exit(EXIT_FAILURE);
-        }
-        memcpy(node->_val, val, size);
-    }   
+        node->_val = node->_data;
+        memcpy(node->_val, val, this->_size);
+    }
     node->_nextNode = NULL;
     return node;
 }
 
+/**
+ * @brief Frees a node together with the value it owns.
+ *
+ * Inline values go away with the node. Strings are freed separately, and
+ * pointers stored in `T` lists are left to the caller.
+ * @param this A pointer to the list that owns the node.
+ * @param node The node to free.
+ * @private
+ */
+void freeNode(ListHeader *this, Node node){
+    if (this->_type == STRING && node->_val != node->_data) releaseString(this, node->_val);
+    recycleNode(this, node);
+}
+
+/**
+ * @brief Frees a node and returns its value as caller-owned memory.
+ *
+ * Inline values, short strings and strings living in a string arena are copied
+ * into a fresh `malloc` block first, as are strings from an allocator other than
+ * `malloc`, keeping the contract of `pop` and `pick` that the returned pointer can be passed to `free()`.
+ * @param this A pointer to the list that owns the node.
+ * @param node The node to release.
+ * @return A pointer to the value, owned by the caller.
+ * @private
+ */
+void *releaseNode(ListHeader *this, Node node){
+    void *val = node->_val;
+    if (val == node->_data || (this->_type == STRING && !mallocStrings(this))) {
+        size_t size = this->_type == STRING ? strlen(val) + 1 : this->_size;
+        val = malloc(size);
+        if (val == NULL) {
+            fprintf(stderr, "Error in releaseNode(): Failed to allocate memory for the returned value.\n");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(val, node->_val, size);
+        if (node->_val != node->_data) releaseString(this, node->_val);
+    }
+    recycleNode(this, node);
+    return val;
+}
+
 /**
  * @brief Prints the contents of the list to standard output.
  * @param this A pointer to the list.
  * @private
  */
-void print(List this){
+void print(ListHeader *this){
     if (this == NULL) {
         fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
         return;
     }
     printf("[");
     for (Node current = this->_head; current != NULL; current = current->_nextNode){
-        switch (this->_type){
-            case INT:
-                printf("%d", *(int *)current->_val);
-                break;
-            case STRING:
-                printf("\"%s\"", (char *)current->_val);
-                break;
-            case DOUBLE:
-                printf("%.2f", *(double *)current->_val);
-                break;
-            case FLOAT:
-                printf("%.2f", *(float *)current->_val);
-                break;
-            case T:
-                printf("%p", current->_val);
-                break;
-        }
+        printValue(this, current->_val);
         if (current->_nextNode != NULL){
             printf(", ");
         }
@@ -197,22 +827,42 @@ void print(List this){
  * it is the caller's responsibility to free the pointed-to data before or after
  * calling this function (e.g., using `foreach`). This function does NOT free
  * the `List` struct itself.
+ *
+ * With a node pool, the nodes are released a slab at a time. The chain is then
+ * only walked for `STRING` lists without a string arena, to free strings too long
+ * to be stored inline. A string arena is released block by block. An intrusive
+ * list just forgets its elements, whose links belong to the caller.
  * @param this A pointer to the list.
  */
-void destroyList(List this){
+void destroyList(ListHeader *this){
     if (this == NULL) {
         fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
         return;
     }
-    Node current = this->_head;
-    while (current != NULL){
-        Node temp = current;
-        current = temp->_nextNode;
-        if(this->_type != T) free(temp->_val);
-        free(temp);
+    struct ListExtras *pool = this->_extras;
+    if (pool->_slabNodes == 0 && !pool->_intrusive) {
+        Node current = this->_head;
+        while (current != NULL){
+            Node temp = current;
+            current = temp->_nextNode;
+            freeNode(this, temp);
+        }
+    } else {
+        if (this->_type == STRING && !pool->_stringArena) {
+            for (Node current = this->_head; current != NULL; current = current->_nextNode){
+                if (current->_val != current->_data) deallocate(this, current->_val);
+            }
+        }
+        while (pool->_slabs != NULL){
+            struct Slab *slab = pool->_slabs;
+            pool->_slabs = slab->_next;
+            deallocate(this, slab);
+        }
     }
+    releaseExtras(this);
     this->_head = NULL;
     this->_tail = NULL;
+    this->_cursor = NULL;
     this->_length = 0;
 }
 
@@ -222,7 +872,7 @@ void destroyList(List this){
  * @param node The node to be added.
  * @private
  */
-void underPush(List this, Node node){
+void underPush(ListHeader *this, Node node){
     if (this->_head == NULL) {
         this->_head = node;
         this->_tail = node;
@@ -244,41 +894,118 @@ void underPush(List this, Node node){
  * - For `T`: `void*`
  * @param this A pointer to the list.
  */
-void push(List this, ...){
+void push(ListHeader *this, ...){
+    if (this == NULL) {
+        fprintf(stderr, "Error in push(): The provided list instance is NULL.\n");
+        return;
+    }
+    va_list args;
+    va_start(args, this);
+    Scalar buf;
+    this->ops->_pushValue(this, readValue(this, &args, &buf));
+    va_end(args);
+}
+
+/**
+ * @brief Adds a new node holding `val` to the end of a `LINKED` list.
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void pushValue(ListHeader *this, void *val){
+    underPush(this, newNode(this, val));
+}
+
+/** @copydoc pushValues */
+void pushValues(ListHeader *this, const unsigned char *src, size_t n){
+    for (size_t i = 0; i < n; i++){
+        this->ops->_pushValue(this, slotValue(this, (unsigned char *)src + i * this->_size));
+    }
+}
+
+/**
+ * @brief Appends a C array of values to a list through its `_pushValues`.
+ * @private
+ */
+static void appendArray(ListHeader *this, const char *caller, const void *src, size_t n){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (n == 0) return;
+    if (src == NULL) {
+        fprintf(stderr, "Error in %s(): The source array is NULL.\n", caller);
+        return;
+    }
+    if (n > (size_t)(INT_MAX - this->_length)) {
+        fprintf(stderr, "Error in %s(): Appending %zu values would overflow the list length.\n", caller, n);
+        return;
+    }
+    this->_version++;
+    this->ops->_pushValues(this, src, n);
+}
+
+/** @copydoc pushArray */
+void pushArray(List list, const void *src, size_t n){
+    appendArray(headerOf(list), "pushArray", src, n);
+}
+
+/** @copydoc pushArrayHeader */
+void pushArrayHeader(ListHeader *header, const void *src, size_t n){
+    appendArray(header, "pushArrayHeader", src, n);
+}
+
+/**
+ * @brief Copies the first `n` values of a list into a C array.
+ * @private
+ */
+static size_t copyArray(ListHeader *this, const char *caller, void *dst, size_t n){
     if (this == NULL) {
-        fprintf(stderr, "Error in push(): The provided list instance is NULL.\n");
-        return;
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return 0;
     }
-    va_list args;
-    va_start(args, this);
-    switch (this->_type){
-        case INT:{
-            int val = va_arg(args, int);
-            underPush(this, newNode(&val, this->_size, this->_type));
-            break;
-        }
-        case STRING:{
-            char *str = va_arg(args, char *);
-            underPush(this, newNode(str, this->_size, this->_type));
-            break;
-        }
-        case DOUBLE:{
-            double dbl = va_arg(args, double);
-            underPush(this, newNode(&dbl, this->_size, this->_type));
-            break;
-        }
-        case FLOAT:{
-            float flt = (float)va_arg(args, double);
-            underPush(this, newNode(&flt, this->_size, this->_type));
-            break;
+    if (n > (size_t)this->_length) n = (size_t)this->_length;
+    if (n == 0) return 0;
+    if (dst == NULL) {
+        fprintf(stderr, "Error in %s(): The destination array is NULL.\n", caller);
+        return 0;
+    }
+    unsigned char *out = dst;
+    if (this->_layout == ARRAY) {
+        memcpy(out, this->_items + (size_t)this->_offset * this->_size, n * this->_size);
+        return n;
+    }
+    if (this->_layout == UNROLLED) {
+        size_t copied = 0;
+        for (struct Chunk *chunk = this->_firstChunk; copied < n; chunk = chunk->_next){
+            size_t take = (size_t)chunk->_count;
+            if (take > n - copied) take = n - copied;
+            memcpy(out + copied * this->_size, chunk->_items, take * this->_size);
+            copied += take;
         }
-        default:{
-            void *unkown = va_arg(args, void *);
-            underPush(this, newNode(unkown, this->_size, this->_type));
-            break;
+        return n;
+    }
+    struct TIterator iterator;
+    startIterator(&iterator, this, this->_extras->_allocator);
+    for (size_t i = 0; i < n; i++){
+        void *val = iterator.next(&iterator);
+        if (this->_type == STRING || this->_type == T) {
+            memcpy(out + i * this->_size, &val, sizeof(void *));
+        } else {
+            memcpy(out + i * this->_size, val, this->_size);
         }
     }
-    va_end(args);
+    return n;
+}
+
+/** @copydoc toArray */
+size_t toArray(List list, void *dst, size_t n){
+    return copyArray(headerOf(list), "toArray", dst, n);
+}
+
+/** @copydoc toArrayHeader */
+size_t toArrayHeader(ListHeader *header, void *dst, size_t n){
+    return copyArray(header, "toArrayHeader", dst, n);
 }
 
 /**
@@ -286,13 +1013,75 @@ void push(List this, ...){
  * @param this A pointer to the list.
  * @return The number of elements.
  */
-int len(List this){
+int len(ListHeader *this){
     if (this == NULL) {
         fprintf(stderr, "Error in len(): The provided list instance is NULL.\n");
     }
     return this->_length;
 }
 
+/**
+ * @brief Returns the node at a position, resuming from the cursor when it can.
+ *
+ * The list remembers the last node a positional operation reached, and its
+ * index. A walk starts from there when the target is at or after it, so a loop
+ * over increasing indices costs O(1) per step instead of O(index). The last
+ * node is reached directly through `_tail`. The index must be in bounds.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the node.
+ * @return The node at `index`, which becomes the cursor.
+ * @private
+ */
+static Node seek(ListHeader *this, int index){
+    Node current = this->_head;
+    int x = 0;
+    if (index == this->_length - 1) {
+        current = this->_tail;
+        x = index;
+    } else if (this->_cursor != NULL && this->_cursorIndex <= index) {
+        current = this->_cursor;
+        x = this->_cursorIndex;
+    }
+    while (x < index){
+        current = current->_nextNode;
+        x++;
+    }
+    this->_cursor = current;
+    this->_cursorIndex = index;
+    return current;
+}
+
+/**
+ * @brief Unlinks the node at a position, without releasing it. The index must be in bounds.
+ *
+ * Keeps `_tail`, `_length` and the cursor consistent: the cursor is dropped if
+ * it was the removed node and moves down one index if it was after it.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the node.
+ * @return The unlinked node.
+ * @private
+ */
+static Node unlinkAt(ListHeader *this, int index){
+    Node node;
+    if (index == 0) {
+        node = this->_head;
+        this->_head = node->_nextNode;
+        if (this->_head == NULL) this->_tail = NULL;
+    } else {
+        Node prev = seek(this, index - 1);
+        node = prev->_nextNode;
+        prev->_nextNode = node->_nextNode;
+        if (node == this->_tail) this->_tail = prev;
+    }
+    this->_length--;
+    if (this->_cursor == node) {
+        this->_cursor = NULL;
+    } else if (this->_cursor != NULL && this->_cursorIndex > index) {
+        this->_cursorIndex--;
+    }
+    return node;
+}
+
 /**
  * @brief Removes the first element (head) of the list and returns its value.
  *
@@ -303,24 +1092,15 @@ int len(List this){
  * @param this A pointer to the list.
  * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
  */
-void *pop(List this){
+void *pop(ListHeader *this){
     if (this == NULL) {
         fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
         return NULL;
     }
     if (this->_head == NULL){
         return NULL;
-    }else {
-        Node current = this->_head;
-        this->_head = current->_nextNode;
-        void *val = current->_val;
-        free(current);
-        this->_length--;
-        if (this->_head == NULL) {
-            this->_tail = NULL;
-        }
-        return val;
     }
+    return releaseNode(this, unlinkAt(this, 0));
 }
 
 /**
@@ -329,7 +1109,7 @@ void *pop(List this){
  * This function provides direct but read-only access to the internal data.
  * The returned pointer is owned by the list and should not be freed by the caller.
  * Its validity is only guaranteed until the next list-modifying operation.
- * For `INT`, `FLOAT`, `DOUBLE`, this will be a pointer to the heap-allocated value.
+ * For `INT`, `FLOAT`, `DOUBLE`, this will be a pointer to the value stored inside the node.
  * For `STRING`, a pointer to the internal string copy.
  * For `T`, the original `void*` that was inserted.
  *
@@ -337,7 +1117,7 @@ void *pop(List this){
  * @param index The zero-based index of the element to retrieve.
  * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
  */
-void *get(List this, int index){
+void *get(ListHeader *this, int index){
     if (this == NULL) {
         fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
         return NULL;
@@ -346,86 +1126,72 @@ void *get(List this, int index){
         fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
         return NULL;
     }
-    int x = 0;
-    Node current = this->_head;
-    while (current != NULL){
-        if (x == index){
-            return current->_val;
-        }
-        current = current->_nextNode;
-        x++;
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
     }
-    fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, x);
-    return NULL;
+    return seek(this, index)->_val;
 }
 
 /**
  * @brief Updates the value of an element at a specific index.
  *
  * This is a variadic function. The argument after `index` must match the list's `Type`.
- * For `STRING`, the old string is freed and a new one is allocated and copied.
+ * For `STRING`, the old string is freed and the new one is copied, inline when it is short.
  * For `T`, the pointer is simply replaced.
  *
  * @param this A pointer to the list.
  * @param index The zero-based index of the element to update.
  */
-void set(List this, int index, ...){
+void set(ListHeader *this, int index, ...){
     if (this == NULL) {
         fprintf(stderr, "Error in set(): The provided list instance is NULL.\n");
         return;
     }
+    va_list args;
+    va_start(args, index);
+    Scalar buf;
+    this->ops->_setValue(this, index, readValue(this, &args, &buf));
+    va_end(args);
+}
+
+/**
+ * @brief Replaces the value a node holds, releasing the old one.
+ *
+ * For `STRING`, the old string is freed and the new one is copied, inline when it is short.
+ * @param this A pointer to the list that owns the node.
+ * @param node The node to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void replaceValue(ListHeader *this, Node node, void *val){
+    if (this->_type == STRING) {
+        if (node->_val != node->_data) releaseString(this, node->_val);
+        storeString(this, node, val);
+    } else if (this->_type == T) {
+        node->_val = val;
+    } else {
+        memcpy(node->_val, val, this->_size);
+    }
+}
+
+/**
+ * @brief Updates the value of the node at a specific index of a `LINKED` list.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void setValue(ListHeader *this, int index, void *val){
     if (index < 0) {
         fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
         return;
     }
-
-    va_list args;
-    va_start(args, index);
-    Node current = this->_head;
-    int x = 0;
-    while (current != NULL){
-        if (x == index) {
-            switch (this->_type){
-                case INT:{
-                    int val = va_arg(args, int);
-                    memcpy(current->_val, &val, this->_size);
-                    break;
-                }
-                case FLOAT:{
-                    float flt = (float)va_arg(args, double);
-                    memcpy(current->_val, &flt, this->_size);
-                    break;
-                }
-                case DOUBLE:{
-                    double dbl = va_arg(args, double);
-                    memcpy(current->_val, &dbl, this->_size);
-                    break;
-                }
-                case STRING:{
-                    char *chr = va_arg(args, char *);
-                    free(current->_val);
-                    current->_val = malloc(strlen(chr) + 1);
-                    if (current->_val == NULL) {
-                        fprintf(stderr, "Error in set(): Failed to allocate memory for the new string value.\n");
-                        exit(EXIT_FAILURE);
-                    }
-                    strcpy((char *)current->_val, chr);
-                    break;
-                }
-                case T:{
-                    void *nil = va_arg(args, void *);
-                    current->_val = nil;
-                    break;
-                }
-            }
-            va_end(args);
-            return;
-        }
-        current = current->_nextNode;
-        x++;
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
     }
-    fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, x);
-    va_end(args);
+    replaceValue(this, seek(this, index), val);
 }
 
 /**
@@ -436,7 +1202,7 @@ void set(List this, int index, ...){
  * @param this A pointer to the list.
  * @param index The zero-based index of the element to delete.
  */
-void delete(List this, int index){
+void delete(ListHeader *this, int index){
     if (this == NULL) {
         fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
         return;
@@ -445,35 +1211,11 @@ void delete(List this, int index){
         fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
         return;
     }
-
-    if (index == 0) {
-        Node temp = this->_head;
-        this->_head = temp->_nextNode;
-        if (this->_head == NULL) this->_tail = NULL;
-        if(this->_type != T) free(temp->_val);
-        free(temp);
-        this->_length--;
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
         return;
     }
-    Node current = this->_head;
-    int x = 0;
-    while (current != NULL){
-        if (index - 1 == x && index != 0){
-            if (current->_nextNode == NULL) break;
-            Node temp = current->_nextNode;
-            current->_nextNode = temp->_nextNode;
-            if (temp == this->_tail) {
-                this->_tail = current;
-            }
-            if(this->_type != T) free(temp->_val);
-            free(temp);
-            this->_length--;
-            return;
-        }
-        current = current->_nextNode;
-        x++;
-    }
-    fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, x);
+    freeNode(this, unlinkAt(this, index));
 }
 
 /**
@@ -483,26 +1225,20 @@ void delete(List this, int index){
  * @param node The node to insert.
  * @private
  */
-void underInsert(List this, int index, Node node){
+void underInsert(ListHeader *this, int index, Node node){
     if (index == 0){
         node->_nextNode = this->_head;
         this->_head = node;
-        this->_length++;
-        return;
+        if (this->_tail == NULL) this->_tail = node;
+    } else {
+        Node prev = seek(this, index - 1);
+        node->_nextNode = prev->_nextNode;
+        prev->_nextNode = node;
+        if (prev == this->_tail) this->_tail = node;
     }
-
-    Node current = this->_head;
-    int x = 0;
-    while (current != NULL){
-        if (x == index - 1){
-            Node temp = current->_nextNode;
-            current->_nextNode = node;
-            node->_nextNode = temp;
-            this->_length++;
-            return;
-        }
-        current = current->_nextNode;
-        x++;
+    this->_length++;
+    if (this->_cursor != NULL && this->_cursorIndex >= index) {
+        this->_cursorIndex++;
     }
 }
 
@@ -513,50 +1249,31 @@ void underInsert(List this, int index, Node node){
  * @param this A pointer to the list.
  * @param index The zero-based index at which to insert the new element.
  */
-void insert(List this, int index, ...){
+void insert(ListHeader *this, int index, ...){
     if (this == NULL) {
         fprintf(stderr, "Error in insert(): The provided list instance is NULL.\n");
         return;
     }
-
-    int list_len = len(this);
-    if (index < 0 || index > list_len) {
-        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, list_len);
-        return;
-    }
-
     va_list args;
     va_start(args, index);
+    Scalar buf;
+    this->ops->_insertValue(this, index, readValue(this, &args, &buf));
+    va_end(args);
+}
 
-    switch (this->_type){
-        case INT:{
-            int val = va_arg(args, int);
-            underInsert(this, index, newNode(&val, this->_size, this->_type));
-            break;
-        }
-        case STRING:{
-            char *str = va_arg(args, char *);
-            underInsert(this, index, newNode(str, this->_size, this->_type));
-            break;
-        }
-        case DOUBLE:{
-            double dbl = va_arg(args, double);
-            underInsert(this, index, newNode(&dbl, this->_size, this->_type));
-            break;
-        }
-        case FLOAT:{
-            float flt = (float)va_arg(args, double);
-            underInsert(this, index, newNode(&flt, this->_size, this->_type));
-            break;
-        }
-        default:{
-            void *unkown = va_arg(args, void *);
-            underInsert(this, index, newNode(unkown, this->_size, this->_type));
-            break;
-        }
+/**
+ * @brief Inserts a new node holding `val` at a specific index of a `LINKED` list.
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void insertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
     }
-
-    va_end(args);
+    underInsert(this, index, newNode(this, val));
 }
 
 /**
@@ -570,7 +1287,7 @@ void insert(List this, int index, ...){
  * @param index The zero-based index of the element to remove.
  * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
  */
-void *pick(List this, int index){
+void *pick(ListHeader *this, int index){
     if (this == NULL) {
         fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
         return NULL;
@@ -579,31 +1296,32 @@ void *pick(List this, int index){
         fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
         return NULL;
     }
-
-    if(index == 0){
-        return this->pop(this);
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
     }
+    return releaseNode(this, unlinkAt(this, index));
+}
 
-    Node current = this->_head;
-    int x = 0;
-    while (current != NULL){
-        if (x == index - 1 && current->_nextNode != NULL){
-            Node temp = current->_nextNode;
-            current->_nextNode = temp->_nextNode;
-            if (temp == this->_tail) {
-                this->_tail = current;
-            }
-            void *n = temp->_val;
-            free(temp);
-            this->_length--;
-            return n;
-        }
-        current = current->_nextNode;
-        x++;
+/**
+ * @brief Removes the last element of the list and returns its value.
+ *
+ * Layouts that cannot reach their last element directly use this: it is `pick`
+ * at the last index, so it is O(n) for `LINKED`, `UNROLLED` and `INDEXED` lists.
+ * The caller takes ownership of the returned pointer, exactly as with `pop`.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *popBack(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in popBack(): The provided list instance is NULL.\n");
+        return NULL;
     }
-
-    fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, x);
-    return NULL;
+    if (this->_length == 0) {
+        return NULL;
+    }
+    return this->ops->pick(this, this->_length - 1);
 }
 
 /**
@@ -612,7 +1330,7 @@ void *pick(List this, int index){
  * @param this A pointer to the list.
  * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
  */
-void foreach(List this, void(*function)(void*)){
+void foreach(ListHeader *this, void(*function)(void*)){
     if (this == NULL) {
         fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
         return;
@@ -633,28 +1351,291 @@ void foreach(List this, void(*function)(void*)){
  * The caller is responsible for freeing the returned list using `list->free(list)`
  * and then `free(list)`.
  *
- * @param this A pointer to the list to be duplicated.
+ * @param original A pointer to the list to be duplicated.
  * @return A new `List` that is a copy of the original, or `NULL` if the
  *         original list was `NULL`.
  */
-List duplicate(List this){
-    if (this == NULL) {
+List duplicate(List original){
+    if (original == NULL) {
         fprintf(stderr, "Error in duplicate(): The provided list instance is NULL.\n");
         return NULL;
     }
-    List list = newList(this->_type);
-    TIterator iterator = newIterator(this);
+    ListHeader *this = &original->_header;
+    List list = this->_type == RECORD ? newRecordList(this->_size, this->_layout)
+                                      : newListOf(this->_type, this->_layout);
+    const struct ListExtras *extras = this->_extras;
+    if (extras->_stringArena) enableStringArena(list, extras->_intern);
+    if ((this->_layout == LINKED || this->_layout == DOUBLY) && extras->_slabNodes != 0) enableNodePool(list, extras->_slabNodes);
+    if (this->ops == &hashedOps) enableHashIndex(list);
+    TIterator iterator = newIterator(original);
     
-    while(hasNext(iterator)){
-        void* val = next(iterator);
-        switch (this->_type){
-            case INT: push(list, *(int *)val); break;
-            case FLOAT: push(list, *(float *)val); break;
-            case DOUBLE: push(list, *(double *)val); break;
-            case STRING: push(list, (char *)val); break;
-            case T: push(list, val); break;
-        }
+    while(iterator->hasNext(iterator)){
+        list->_header.ops->_pushValue(&list->_header, iterator->next(iterator));
     }
     iterator->free(iterator);
     return list;
 }
+
+/**
+ * @brief Drops every element of a list whose values were copied elsewhere, keeping its options.
+ *
+ * The layout's `free` releases the elements in one walk, with no copy of any
+ * value, but turns the options off; they are turned back on for the empty list.
+ * Intrusive lists never get here.
+ * @private
+ */
+static void clearValues(ListHeader *this){
+    const struct ListExtras *extras = this->_extras;
+    bool hashed = this->ops == &hashedOps;
+    bool stringArena = extras->_stringArena;
+    bool intern = extras->_intern;
+    size_t slabNodes = extras->_slabNodes;
+    this->ops->free(this);
+    if (stringArena) enableStringArenaHeader(this, intern);
+    if (slabNodes != 0) enableNodePoolHeader(this, slabNodes);
+    if (hashed) enableHashIndexHeader(this);
+}
+
+/** @copydoc concatValues */
+void concatValues(ListHeader *this, ListHeader *src){
+    if (src->_extras->_intrusive) {
+        while (src->_length > 0){
+            this->ops->_pushValue(this, src->ops->pop(src));
+        }
+        return;
+    }
+    struct TIterator iterator;
+    startIterator(&iterator, src, src->_extras->_allocator);
+    while (iterator.hasNext(&iterator)){
+        this->ops->_pushValue(this, iterator.next(&iterator));
+    }
+    clearValues(src);
+}
+
+/** @copydoc splitValues */
+void splitValues(ListHeader *this, int index, ListHeader *suffix){
+    if (this->_layout == INDEXED) {
+        if (this->ops == &hashedOps) unindexFrom(this, index);
+        indexedSplitAt(this, index, suffix);
+        return;
+    }
+    if (this->_extras->_intrusive) {
+        while (this->_length > index){
+            suffix->ops->_pushValue(suffix, this->ops->pick(this, index));
+        }
+        return;
+    }
+    struct TIterator iterator;
+    startIterator(&iterator, this, this->_extras->_allocator);
+    advanceIterator(&iterator, index);
+    while (iterator.hasNext(&iterator)){
+        suffix->ops->_pushValue(suffix, iterator.next(&iterator));
+    }
+    while (this->_length > index){
+        this->ops->remove(this, this->_layout == LINKED ? index : this->_length - 1);
+    }
+}
+
+/**
+ * @brief Appends the nodes of `src` to a `LINKED` list in O(1).
+ * @private
+ */
+void concatNodes(ListHeader *this, ListHeader *src){
+    if (src->_head == NULL) return;
+    if (this->_tail == NULL) {
+        this->_head = src->_head;
+    } else {
+        this->_tail->_nextNode = src->_head;
+    }
+    this->_tail = src->_tail;
+    this->_length += src->_length;
+    src->_head = NULL;
+    src->_tail = NULL;
+    src->_cursor = NULL;
+    src->_length = 0;
+}
+
+/**
+ * @brief Detaches the nodes of a `LINKED` list from `index` onwards into `suffix`.
+ *
+ * `index` is strictly between 0 and the length; the walk to it uses the cursor.
+ * @private
+ */
+void splitNodes(ListHeader *this, int index, ListHeader *suffix){
+    Node last = seek(this, index - 1);
+    suffix->_head = last->_nextNode;
+    suffix->_tail = this->_tail;
+    suffix->_length = this->_length - index;
+    last->_nextNode = NULL;
+    this->_tail = last;
+    this->_length = index;
+}
+
+/**
+ * @brief Sorts a `LINKED` list by relinking its nodes. The cursor is dropped.
+ * @private
+ */
+void sortChain(ListHeader *this, const struct SortPlan *plan){
+    this->_head = sortNodes(this, this->_head, &this->_tail, plan);
+    this->_cursor = NULL;
+}
+
+/**
+ * @brief Tells whether `concat` can relink the nodes or chunks of `src` into `this`.
+ *
+ * Both lists must have the same layout and allocate from the same place, and
+ * neither may own its nodes through a pool or its strings through an arena.
+ * Hash-indexed lists move their elements through their methods instead, which
+ * keep the indexes up to date.
+ * @private
+ */
+static bool relinkable(ListHeader *this, ListHeader *src){
+    if (this->ops == &hashedOps || src->ops == &hashedOps) {
+        return false;
+    }
+    const struct ListExtras *mine = this->_extras;
+    const struct ListExtras *theirs = src->_extras;
+    if (this->_layout != src->_layout || mine->_arena != theirs->_arena || mine->_allocator != theirs->_allocator) {
+        return false;
+    }
+    if (this->_type == STRING && (mine->_stringArena || theirs->_stringArena)) {
+        return false;
+    }
+    if (this->_layout == LINKED || this->_layout == DOUBLY) {
+        return mine->_slabNodes == 0 && theirs->_slabNodes == 0 && mine->_intrusive == theirs->_intrusive &&
+               (!mine->_intrusive || mine->_linkOffset == theirs->_linkOffset);
+    }
+    return true;
+}
+
+/**
+ * @brief Checks a `concat` request and moves the elements of `src` to the end of `this`.
+ * @private
+ */
+static void concatLists(ListHeader *this, ListHeader *src, const char *caller){
+    if (this == NULL || src == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (this == src) {
+        fprintf(stderr, "Error in %s(): A list cannot be concatenated with itself.\n", caller);
+        return;
+    }
+    if (this->_type != src->_type || this->_size != src->_size) {
+        fprintf(stderr, "Error in %s(): Both lists must hold the same type.\n", caller);
+        return;
+    }
+    if (src->_length > INT_MAX - this->_length) {
+        fprintf(stderr, "Error in %s(): The combined length would overflow.\n", caller);
+        return;
+    }
+    this->_version++;
+    src->_version++;
+    if (relinkable(this, src)) {
+        this->ops->_concat(this, src);
+    } else {
+        concatValues(this, src);
+    }
+}
+
+/** @copydoc concat */
+void concat(List dst, List src){
+    concatLists(headerOf(dst), headerOf(src), "concat");
+}
+
+/** @copydoc concatHeaders */
+void concatHeaders(ListHeader *dst, ListHeader *src){
+    concatLists(dst, src, "concatHeaders");
+}
+
+/**
+ * @brief Reports a NULL list or an index outside 0 to the list's length.
+ * @private
+ * @return `true` if the list can be split at `index`.
+ */
+static bool splittable(ListHeader *this, int index, const char *caller){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return false;
+    }
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in %s(): Index %d is out of bounds. Valid range is 0 to %d.\n", caller, index, this->_length);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Gives a freshly initialized `suffix` the options of `this`, then moves the elements from `index` onwards into it.
+ *
+ * `suffix` already draws its memory from where `this` does.
+ * @private
+ */
+static void splitInto(ListHeader *this, int index, ListHeader *suffix){
+    const struct ListExtras *extras = this->_extras;
+    if (extras->_stringArena) enableStringArenaHeader(suffix, extras->_intern);
+    if (this->ops == &hashedOps) enableHashIndexHeader(suffix);
+    if (this->_layout == LINKED || this->_layout == DOUBLY) {
+        if (extras->_slabNodes != 0) enableNodePoolHeader(suffix, extras->_slabNodes);
+        if (extras->_intrusive) enableIntrusiveHeader(suffix, extras->_linkOffset);
+    }
+
+    if (index == this->_length) return;
+    this->_version++;
+    if (!relinkable(suffix, this)) {
+        splitValues(this, index, suffix);
+    } else if (index == 0) {
+        this->ops->_concat(suffix, this);
+    } else {
+        this->ops->_splitAt(this, index, suffix);
+    }
+}
+
+/** @copydoc splitAt */
+List splitAt(List list, int index){
+    ListHeader *this = headerOf(list);
+    if (!splittable(this, index, "splitAt")) return NULL;
+    const struct ListExtras *extras = this->_extras;
+    bool block = extras->_arena != NULL || extras->_allocator != NULL;
+    List suffix = allocate(this, block ? sizeof(struct ListBlock) : sizeof(struct Lista));
+    if (suffix == NULL) {
+        fprintf(stderr, "Error in splitAt(): Failed to allocate memory for the new list.\n");
+        exit(EXIT_FAILURE);
+    }
+    initHeader(&suffix->_header, this->_type, this->_size, this->_layout);
+    bindMethods(suffix);
+    if (block) bindMemory((struct ListBlock *)suffix, extras->_arena, extras->_allocator);
+    splitInto(this, index, &suffix->_header);
+    return suffix;
+}
+
+/** @copydoc splitAtHeader */
+bool splitAtHeader(ListHeader *header, int index, ListHeader *suffix){
+    if (!splittable(header, index, "splitAtHeader")) return false;
+    if (suffix == NULL || suffix == header) {
+        fprintf(stderr, "Error in splitAtHeader(): The suffix must be a separate header.\n");
+        return false;
+    }
+    if (header->_extras->_arena != NULL || header->_extras->_allocator != NULL) {
+        fprintf(stderr, "Error in splitAtHeader(): Lists with an arena or allocator are split with splitAt().\n");
+        return false;
+    }
+    initHeader(suffix, header->_type, header->_size, header->_layout);
+    splitInto(header, index, suffix);
+    return true;
+}
+
+/**
+ * @brief Searches the node chain.
+ * @private
+ */
+int findChain(ListHeader *this, const struct SearchPlan *plan){
+    return searchNodes(this, this->_head, plan);
+}
+
+/** @private */
+const struct ListOps linkedOps = {
+    push, pop, print, len, destroyList, get, set, delete, insert, pick, foreach,
+    popBack, pushValue, setValue, insertValue, pushValues,
+    concatNodes, splitNodes, sortChain, findChain
+};
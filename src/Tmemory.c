@@ -0,0 +1,260 @@
+/**
+ * @file Tmemory.c
+ * @brief Storage allocation for lists: the C heap, user allocator hooks, or a caller-supplied bump arena.
+ *
+ * Every allocation a list makes for itself goes through `allocate`,
+ * `reallocate` and `deallocate`. Lists created with `newListWith` call their
+ * `ListAllocator` hooks there. Lists created with `newListIn` are served
+ * from their `ListArena` by bumping an offset; their memory is never handed
+ * back individually and is dropped at once by `resetListArena`.
+ *
+ * The arena or allocator of a list is kept in its `ListExtras`, next to the
+ * state of its other options, so that lists using none of them share the
+ * read-only `noExtras` and carry a single pointer for all of them.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+#include <stdint.h>
+
+/**
+ * @brief Carves `size` bytes, aligned for any type, out of an arena.
+ * @return The memory, or NULL when the arena is exhausted.
+ * @private
+ */
+static void *arenaAllocate(ListArena *arena, size_t size){
+    uintptr_t base = (uintptr_t)arena->_buffer;
+    uintptr_t start = (base + arena->_used + _Alignof(max_align_t) - 1) & ~(uintptr_t)(_Alignof(max_align_t) - 1);
+    size_t offset = (size_t)(start - base);
+    if (offset > arena->_capacity || size > arena->_capacity - offset) {
+        return NULL;
+    }
+    arena->_used = offset + size;
+    return arena->_buffer + offset;
+}
+
+/** @copydoc initListArena */
+void initListArena(ListArena *arena, void *buffer, size_t capacity){
+    if (arena == NULL) {
+        fprintf(stderr, "Error in initListArena(): The provided arena is NULL.\n");
+        return;
+    }
+    arena->_buffer = buffer;
+    arena->_capacity = buffer == NULL ? 0 : capacity;
+    arena->_used = 0;
+}
+
+/** @copydoc resetListArena */
+void resetListArena(ListArena *arena){
+    if (arena == NULL) {
+        fprintf(stderr, "Error in resetListArena(): The provided arena is NULL.\n");
+        return;
+    }
+    arena->_used = 0;
+}
+
+/**
+ * @brief Carves a `ListBlock` from `arena`, or allocates one with `allocator`.
+ * @param caller The public function to name in error messages.
+ * @param arena The arena to allocate from, or NULL.
+ * @param allocator The allocator to allocate with, when `arena` is NULL.
+ * @return The uninitialized block.
+ * @private
+ */
+static struct ListBlock *allocateBlock(const char *caller, ListArena *arena, const ListAllocator *allocator){
+    if (arena != NULL) {
+        struct ListBlock *block = arenaAllocate(arena, sizeof(struct ListBlock));
+        if (block == NULL) {
+            fprintf(stderr, "Error in %s(): The arena has no room for the new list.\n", caller);
+            exit(EXIT_FAILURE);
+        }
+        return block;
+    }
+    struct ListBlock *block = allocator->malloc(allocator->context, sizeof(struct ListBlock));
+    if (block == NULL) {
+        fprintf(stderr, "Error in %s(): Failed to allocate memory for the new list.\n", caller);
+        exit(EXIT_FAILURE);
+    }
+    return block;
+}
+
+/** @copydoc newListIn */
+List newListIn(ListArena *arena, Type type, Layout layout){
+    if (arena == NULL) {
+        fprintf(stderr, "Error in newListIn(): The provided arena is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (type == RECORD) {
+        fprintf(stderr, "Error in newListIn(): RECORD lists need a record size; use newRecordListIn().\n");
+        return NULL;
+    }
+    struct ListBlock *block = allocateBlock("newListIn", arena, NULL);
+    initList(&block->_list, type, layout);
+    bindMemory(block, arena, NULL);
+    return &block->_list;
+}
+
+/** @copydoc newRecordListIn */
+List newRecordListIn(ListArena *arena, size_t recordSize, Layout layout){
+    if (arena == NULL) {
+        fprintf(stderr, "Error in newRecordListIn(): The provided arena is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (recordSize == 0) {
+        fprintf(stderr, "Error in newRecordListIn(): The record size must be greater than zero.\n");
+        return NULL;
+    }
+    struct ListBlock *block = allocateBlock("newRecordListIn", arena, NULL);
+    initRecordList(&block->_list, recordSize, layout);
+    bindMemory(block, arena, NULL);
+    return &block->_list;
+}
+
+/** @copydoc newListWith */
+List newListWith(Type type, Layout layout, const ListAllocator *allocator){
+    if (type == RECORD) {
+        fprintf(stderr, "Error in newListWith(): RECORD lists need a record size; use newRecordListWith().\n");
+        return NULL;
+    }
+    if (allocator == NULL) return newListOf(type, layout);
+    struct ListBlock *block = allocateBlock("newListWith", NULL, allocator);
+    initList(&block->_list, type, layout);
+    bindMemory(block, NULL, allocator);
+    return &block->_list;
+}
+
+/** @copydoc newRecordListWith */
+List newRecordListWith(size_t recordSize, Layout layout, const ListAllocator *allocator){
+    if (recordSize == 0) {
+        fprintf(stderr, "Error in newRecordListWith(): The record size must be greater than zero.\n");
+        return NULL;
+    }
+    if (allocator == NULL) return newRecordList(recordSize, layout);
+    struct ListBlock *block = allocateBlock("newRecordListWith", NULL, allocator);
+    initRecordList(&block->_list, recordSize, layout);
+    bindMemory(block, NULL, allocator);
+    return &block->_list;
+}
+
+/** @private */
+const struct ListExtras noExtras = {0};
+
+/**
+ * @brief Points a list at the extension of its `ListBlock`, holding `arena` or `allocator`.
+ *
+ * The extension lives and dies with the list, so `releaseExtras` only resets it.
+ * @param block The block of a freshly initialized list.
+ * @param arena The arena the list allocates from, or NULL.
+ * @param allocator The allocator the list allocates with, or NULL.
+ * @private
+ */
+void bindMemory(struct ListBlock *block, ListArena *arena, const ListAllocator *allocator){
+    block->_extras = noExtras;
+    block->_extras._arena = arena;
+    block->_extras._allocator = allocator;
+    block->_list._header._extras = &block->_extras;
+}
+
+/**
+ * @brief Returns the list's own extension, giving it one on the first option enabled.
+ *
+ * Lists with an arena or an allocator own one from the start, so a new
+ * extension is always a plain heap list's and comes from `malloc`.
+ * @param this A pointer to the list.
+ * @return The extension, which can be written to.
+ * @private
+ */
+struct ListExtras *ownExtras(ListHeader *this){
+    if (this->_extras == &noExtras) {
+        struct ListExtras *extras = malloc(sizeof(struct ListExtras));
+        if (extras == NULL) {
+            fprintf(stderr, "Error in ownExtras(): Failed to allocate memory for the list options.\n");
+            exit(EXIT_FAILURE);
+        }
+        *extras = noExtras;
+        this->_extras = extras;
+    }
+    return this->_extras;
+}
+
+/**
+ * @brief Releases the string arena and the hash index and turns every option off.
+ *
+ * Called by the `free` method of every layout, after its elements are gone.
+ * @param this A pointer to the list.
+ * @private
+ */
+void releaseExtras(ListHeader *this){
+    struct ListExtras *extras = this->_extras;
+    this->ops = layoutOps(this->_layout);
+    if (extras == &noExtras) return;
+    releaseStrings(this);
+    releaseIndex(this);
+    if (extras->_arena != NULL || extras->_allocator != NULL) {
+        bindMemory((struct ListBlock *)((unsigned char *)this - offsetof(struct ListBlock, _list._header)),
+                   extras->_arena, extras->_allocator);
+    } else {
+        free(extras);
+        this->_extras = (struct ListExtras *)&noExtras;
+    }
+}
+
+/**
+ * @brief Allocates `size` bytes for a list, from its `ListArena` or `ListAllocator` if it has one.
+ * @param this A pointer to the list.
+ * @param size The number of bytes.
+ * @return The memory, or NULL when it cannot be allocated.
+ * @private
+ */
+void *allocate(ListHeader *this, size_t size){
+    const struct ListExtras *extras = this->_extras;
+    if (extras->_arena != NULL) return arenaAllocate(extras->_arena, size);
+    if (extras->_allocator != NULL) return extras->_allocator->malloc(extras->_allocator->context, size);
+    return malloc(size);
+}
+
+/**
+ * @brief Resizes a block obtained from `allocate`, like `realloc`.
+ *
+ * In an arena, the most recent block grows in place when there is room;
+ * any other block is copied to a fresh one.
+ * @param this A pointer to the list.
+ * @param ptr The block to resize, or NULL.
+ * @param oldSize The current size of the block.
+ * @param size The new size.
+ * @return The resized block, or NULL when it cannot be allocated (the old block is kept).
+ * @private
+ */
+void *reallocate(ListHeader *this, void *ptr, size_t oldSize, size_t size){
+    const struct ListExtras *extras = this->_extras;
+    if (extras->_arena == NULL) {
+        if (extras->_allocator != NULL) return extras->_allocator->realloc(extras->_allocator->context, ptr, size);
+        return realloc(ptr, size);
+    }
+    ListArena *arena = extras->_arena;
+    if (ptr != NULL && (unsigned char *)ptr + oldSize == arena->_buffer + arena->_used) {
+        size_t offset = (size_t)((unsigned char *)ptr - arena->_buffer);
+        if (size <= arena->_capacity - offset) {
+            arena->_used = offset + size;
+            return ptr;
+        }
+    }
+    void *fresh = arenaAllocate(arena, size);
+    if (fresh != NULL && ptr != NULL) memcpy(fresh, ptr, oldSize < size ? oldSize : size);
+    return fresh;
+}
+
+/**
+ * @brief Releases a block obtained from `allocate`.
+ *
+ * Arena blocks are only reclaimed by `resetListArena`, so this is a no-op for them.
+ * @param this A pointer to the list.
+ * @param ptr The block to release.
+ * @private
+ */
+void deallocate(ListHeader *this, void *ptr){
+    const struct ListExtras *extras = this->_extras;
+    if (extras->_arena != NULL) return;
+    if (extras->_allocator != NULL) extras->_allocator->free(extras->_allocator->context, ptr);
+    else free(ptr);
+}
@@ -0,0 +1,686 @@
+/**
+ * @file Trope.c
+ * @brief Implementation of the `ROPE` list layout.
+ *
+ * A rope keeps its elements in chunks of up to `_ropeCapacity` elements, and
+ * keeps the chunks, in list order, as the in-order sequence of a treap: a
+ * binary tree that is a heap on random priorities and so stays balanced in
+ * expectation. Every tree node records how many elements its subtree holds,
+ * which turns `get`, `set`, `insert`, `remove` and `pick` at any index into an
+ * O(log n) descent followed by a shift inside one chunk.
+ *
+ * A full chunk is split in two on insertion; appending to the end of a full
+ * chunk starts a new one instead, so a list built by `push` has full chunks. A
+ * chunk whose last element is removed is taken out of the tree and freed.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Returns the address of slot `i` of a chunk.
+ * @private
+ */
+static unsigned char *slotAt(ListHeader *this, struct RopeNode *node, int i){
+    return node->_items + (size_t)i * this->_size;
+}
+
+/**
+ * @brief Returns the number of elements in a subtree.
+ * @private
+ */
+static int countOf(struct RopeNode *node){
+    return node == NULL ? 0 : node->_count;
+}
+
+/**
+ * @brief Allocates an empty chunk with a fresh random priority.
+ * @private
+ */
+static struct RopeNode *newRopeNode(ListHeader *this){
+    struct RopeNode *node = allocate(this, sizeof(struct RopeNode) + (size_t)this->_ropeCapacity * this->_size);
+    if (node == NULL) {
+        fprintf(stderr, "Error in newRopeNode(): Failed to allocate memory for a new chunk.\n");
+        exit(EXIT_FAILURE);
+    }
+    unsigned int x = this->_ropeSeed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    this->_ropeSeed = x;
+    node->_left = NULL;
+    node->_right = NULL;
+    node->_count = 0;
+    node->_used = 0;
+    node->_priority = x;
+    return node;
+}
+
+/**
+ * @brief Finds the chunk holding the element at `index`.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element. Must be in bounds.
+ * @param offset Receives the position of the element inside the returned chunk.
+ * @return The chunk holding the element.
+ * @private
+ */
+static struct RopeNode *locate(ListHeader *this, int index, int *offset){
+    struct RopeNode *node = this->_ropeRoot;
+    for (;;){
+        int left = countOf(node->_left);
+        if (index < left) {
+            node = node->_left;
+        } else if (index < left + node->_used) {
+            *offset = index - left;
+            return node;
+        } else {
+            index -= left + node->_used;
+            node = node->_right;
+        }
+    }
+}
+
+/**
+ * @brief Recomputes the element count of a subtree from its children.
+ * @private
+ */
+static void recount(struct RopeNode *node){
+    node->_count = countOf(node->_left) + node->_used + countOf(node->_right);
+}
+
+/**
+ * @brief Restores the heap order between a node and its children after one of them changed.
+ *
+ * A child with a higher priority than its parent is rotated above it.
+ * @return The new subtree root.
+ * @private
+ */
+static struct RopeNode *rebalance(struct RopeNode *node){
+    struct RopeNode *child = node->_left;
+    if (child != NULL && child->_priority > node->_priority) {
+        node->_left = child->_right;
+        child->_right = node;
+        recount(node);
+        recount(child);
+        return child;
+    }
+    child = node->_right;
+    if (child != NULL && child->_priority > node->_priority) {
+        node->_right = child->_left;
+        child->_left = node;
+        recount(node);
+        recount(child);
+        return child;
+    }
+    recount(node);
+    return node;
+}
+
+/**
+ * @brief Joins two treaps whose elements are in order, `a` before `b`.
+ * @private
+ */
+static struct RopeNode *join(struct RopeNode *a, struct RopeNode *b){
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (a->_priority >= b->_priority) {
+        a->_right = join(a->_right, b);
+        recount(a);
+        return a;
+    }
+    b->_left = join(a, b->_left);
+    b->_count = countOf(b->_left) + b->_used + countOf(b->_right);
+    return b;
+}
+
+/**
+ * @brief Adds `fresh` as the first chunk of a subtree, keeping the heap order.
+ * @private
+ */
+static struct RopeNode *prepend(struct RopeNode *node, struct RopeNode *fresh){
+    if (node == NULL) return fresh;
+    if (fresh->_priority > node->_priority) {
+        fresh->_right = node;
+        recount(fresh);
+        return fresh;
+    }
+    node->_left = prepend(node->_left, fresh);
+    recount(node);
+    return node;
+}
+
+/**
+ * @brief Inserts a value at `index` of a subtree and returns the new subtree root.
+ * @private
+ */
+static struct RopeNode *insertAt(ListHeader *this, struct RopeNode *node, int index, void *val){
+    int left = countOf(node->_left);
+    if (index < left) {
+        node->_left = insertAt(this, node->_left, index, val);
+    } else if (index > left + node->_used) {
+        node->_right = insertAt(this, node->_right, index - left - node->_used, val);
+    } else {
+        int offset = index - left;
+        struct RopeNode *target = node;
+        if (node->_used == this->_ropeCapacity) {
+            struct RopeNode *fresh = newRopeNode(this);
+            if (offset < node->_used) {
+                int keep = node->_used / 2;
+                fresh->_used = node->_used - keep;
+                memcpy(fresh->_items, slotAt(this, node, keep), (size_t)fresh->_used * this->_size);
+                node->_used = keep;
+                if (offset > keep) {
+                    target = fresh;
+                    offset -= keep;
+                }
+            } else {
+                target = fresh;
+                offset = 0;
+            }
+            if (target == fresh) {
+                memmove(slotAt(this, fresh, offset + 1), slotAt(this, fresh, offset),
+                        (size_t)(fresh->_used - offset) * this->_size);
+                storeValue(this, slotAt(this, fresh, offset), val);
+                fresh->_used++;
+            }
+            recount(fresh);
+            node->_right = prepend(node->_right, fresh);
+        }
+        if (target == node) {
+            memmove(slotAt(this, node, offset + 1), slotAt(this, node, offset),
+                    (size_t)(node->_used - offset) * this->_size);
+            storeValue(this, slotAt(this, node, offset), val);
+            node->_used++;
+        }
+    }
+    return rebalance(node);
+}
+
+/**
+ * @brief Removes the element at `index` of a subtree, without releasing its value.
+ *
+ * A chunk left empty is unlinked and freed.
+ * @return The new subtree root.
+ * @private
+ */
+static struct RopeNode *removeAt(ListHeader *this, struct RopeNode *node, int index){
+    int left = countOf(node->_left);
+    if (index < left) {
+        node->_left = removeAt(this, node->_left, index);
+    } else if (index >= left + node->_used) {
+        node->_right = removeAt(this, node->_right, index - left - node->_used);
+    } else {
+        int offset = index - left;
+        node->_used--;
+        memmove(slotAt(this, node, offset), slotAt(this, node, offset + 1),
+                (size_t)(node->_used - offset) * this->_size);
+        if (node->_used == 0) {
+            struct RopeNode *rest = join(node->_left, node->_right);
+            deallocate(this, node);
+            return rest;
+        }
+    }
+    node->_count--;
+    return node;
+}
+
+/**
+ * @brief Removes the element at `index` from the list, without releasing its value.
+ * @private
+ */
+static void extract(ListHeader *this, int index){
+    this->_ropeRoot = removeAt(this, this->_ropeRoot, index);
+    this->_length--;
+}
+
+/**
+ * @brief Applies a function to every element of a subtree, in order.
+ * @private
+ */
+static void walk(ListHeader *this, struct RopeNode *node, void(*function)(void*)){
+    while (node != NULL){
+        walk(this, node->_left, function);
+        for (int i = 0; i < node->_used; i++){
+            function(slotValue(this, slotAt(this, node, i)));
+        }
+        node = node->_right;
+    }
+}
+
+/**
+ * @brief Frees every chunk of a subtree and the strings it owns.
+ * @private
+ */
+static void release(ListHeader *this, struct RopeNode *node){
+    while (node != NULL){
+        release(this, node->_left);
+        if (this->_type == STRING && !this->_extras->_stringArena) {
+            for (int i = 0; i < node->_used; i++){
+                releaseSlot(this, slotAt(this, node, i));
+            }
+        }
+        struct RopeNode *right = node->_right;
+        deallocate(this, node);
+        node = right;
+    }
+}
+
+/**
+ * @brief Prints the contents of the list to standard output.
+ * @param this A pointer to the list.
+ * @private
+ */
+void ropePrint(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
+        return;
+    }
+    printf("[");
+    for (int i = 0; i < this->_length; ){
+        int offset;
+        struct RopeNode *node = locate(this, i, &offset);
+        for (; offset < node->_used; offset++, i++){
+            printValue(this, slotValue(this, slotAt(this, node, offset)));
+            if (i + 1 < this->_length){
+                printf(", ");
+            }
+        }
+    }
+    printf("]");
+    printf("\n");
+}
+
+/**
+ * @brief Frees all the chunks in the list and the strings they own.
+ *
+ * As with the `LINKED` layout, pointers stored in a `T` list are not freed.
+ * This function does NOT free the `List` struct itself.
+ * @param this A pointer to the list.
+ * @private
+ */
+void ropeDestroy(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
+        return;
+    }
+    release(this, this->_ropeRoot);
+    releaseExtras(this);
+    this->_ropeRoot = NULL;
+    this->_length = 0;
+}
+
+/**
+ * @brief Inserts a new element at a specific index in O(log n).
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void ropeInsertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
+    }
+    if (this->_ropeRoot == NULL) {
+        this->_ropeRoot = newRopeNode(this);
+    }
+    this->_ropeRoot = insertAt(this, this->_ropeRoot, index, val);
+    this->_length++;
+}
+
+/**
+ * @brief Adds a new element to the end of the list in O(log n).
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void ropePushValue(ListHeader *this, void *val){
+    ropeInsertValue(this, this->_length, val);
+}
+
+/**
+ * @brief Removes the first element of the list and returns its value.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *ropePop(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_length == 0) {
+        return NULL;
+    }
+    int offset;
+    struct RopeNode *node = locate(this, 0, &offset);
+    void *val = takeSlot(this, slotAt(this, node, offset));
+    extract(this, 0);
+    return val;
+}
+
+/**
+ * @brief Retrieves a pointer to the element at a specific index in O(log n).
+ *
+ * The returned pointer is invalidated by any operation that shifts or splits its chunk.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to retrieve.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *ropeGet(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    int offset;
+    struct RopeNode *node = locate(this, index, &offset);
+    return slotValue(this, slotAt(this, node, offset));
+}
+
+/**
+ * @brief Updates the value of an element at a specific index in O(log n).
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void ropeSetValue(ListHeader *this, int index, void *val){
+    if (index < 0) {
+        fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    int offset;
+    struct RopeNode *node = locate(this, index, &offset);
+    releaseSlot(this, slotAt(this, node, offset));
+    storeValue(this, slotAt(this, node, offset), val);
+}
+
+/**
+ * @brief Deletes the element at a specific index in O(log n), freeing the string it owns.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to delete.
+ * @private
+ */
+void ropeDelete(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    int offset;
+    struct RopeNode *node = locate(this, index, &offset);
+    releaseSlot(this, slotAt(this, node, offset));
+    extract(this, index);
+}
+
+/**
+ * @brief Removes and returns the element at a specific index in O(log n).
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to remove.
+ * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *ropePick(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    int offset;
+    struct RopeNode *node = locate(this, index, &offset);
+    void *val = takeSlot(this, slotAt(this, node, offset));
+    extract(this, index);
+    return val;
+}
+
+/**
+ * @brief Applies a given function to each element in the list.
+ * @param this A pointer to the list.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ * @private
+ */
+void ropeForeach(ListHeader *this, void(*function)(void*)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
+        return;
+    }
+    walk(this, this->_ropeRoot, function);
+}
+
+/**
+ * @brief Returns the next element of a `ROPE` list iteration.
+ *
+ * Within a chunk this is a slot step; the next chunk is found by a descent from the root.
+ * @param iterator A pointer to the iterator.
+ * @return A pointer to the next element's value, or `NULL` if the end is reached or the iterator is invalid.
+ * @private
+ */
+void *ropeNext(TIterator iterator){
+    if (iterator == NULL || iterator->_index >= iterator->_list->_length) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    if (iterator->_leaf == NULL || iterator->_slot >= iterator->_leaf->_used) {
+        iterator->_leaf = locate(iterator->_list, iterator->_index, &iterator->_slot);
+    }
+    iterator->_index++;
+    return slotValue(iterator->_list, slotAt(iterator->_list, iterator->_leaf, iterator->_slot++));
+}
+
+/**
+ * @brief Checks if a `ROPE` list iteration has more elements.
+ * @param iterator A pointer to the iterator.
+ * @return `true` if there is at least one more element to iterate over, `false` otherwise.
+ * @private
+ */
+bool ropeHasNext(TIterator iterator){
+    if (iterator == NULL) {
+        return false;
+    }
+    return iterator->_index < iterator->_list->_length;
+}
+
+/**
+ * @brief Splits a subtree into its first `index` elements and the rest.
+ *
+ * A chunk straddling the boundary is cut in two, the upper part becoming a new
+ * chunk of `suffix`. The new chunk's priority is capped at the cut chunk's, since
+ * the subtree it joins is hung under the cut chunk's ancestors.
+ * @private
+ */
+static void cut(ListHeader *this, ListHeader *suffix, struct RopeNode *node, int index,
+                struct RopeNode **left, struct RopeNode **right){
+    if (node == NULL) {
+        *left = NULL;
+        *right = NULL;
+        return;
+    }
+    int before = countOf(node->_left);
+    if (index <= before) {
+        cut(this, suffix, node->_left, index, left, &node->_left);
+        recount(node);
+        *right = node;
+    } else if (index >= before + node->_used) {
+        cut(this, suffix, node->_right, index - before - node->_used, &node->_right, right);
+        recount(node);
+        *left = node;
+    } else {
+        int offset = index - before;
+        struct RopeNode *fresh = newRopeNode(suffix);
+        fresh->_used = node->_used - offset;
+        memcpy(fresh->_items, slotAt(this, node, offset), (size_t)fresh->_used * this->_size);
+        recount(fresh);
+        if (fresh->_priority > node->_priority) fresh->_priority = node->_priority;
+        node->_used = offset;
+        *right = prepend(node->_right, fresh);
+        node->_right = NULL;
+        recount(node);
+        *left = node;
+    }
+}
+
+/**
+ * @brief Unlinks and frees the first chunk of a subtree, which must not be empty.
+ * @return The new subtree root.
+ * @private
+ */
+static struct RopeNode *dropFirst(ListHeader *this, struct RopeNode *node){
+    if (node->_left == NULL) {
+        struct RopeNode *rest = node->_right;
+        deallocate(this, node);
+        return rest;
+    }
+    node->_left = dropFirst(this, node->_left);
+    recount(node);
+    return node;
+}
+
+/**
+ * @brief Appends the chunks of `src` by joining the two trees, in O(log n).
+ *
+ * When the last chunk of `this` and the first chunk of `src` fit in one, as
+ * the two halves of a chunk cut by `splitAt` do, the second is merged into the
+ * first, so that repeated splits and concatenations do not fragment the list.
+ * @private
+ */
+void ropeConcat(ListHeader *this, ListHeader *src){
+    struct RopeNode *last = this->_ropeRoot;
+    struct RopeNode *first = src->_ropeRoot;
+    while (last != NULL && last->_right != NULL) last = last->_right;
+    while (first != NULL && first->_left != NULL) first = first->_left;
+    if (last != NULL && first != NULL && last->_used + first->_used <= this->_ropeCapacity) {
+        memcpy(slotAt(this, last, last->_used), first->_items, (size_t)first->_used * this->_size);
+        for (struct RopeNode *node = this->_ropeRoot; node != NULL; node = node->_right){
+            node->_count += first->_used;
+        }
+        last->_used += first->_used;
+        src->_ropeRoot = dropFirst(src, src->_ropeRoot);
+    }
+    this->_ropeRoot = join(this->_ropeRoot, src->_ropeRoot);
+    this->_length += src->_length;
+    src->_ropeRoot = NULL;
+    src->_length = 0;
+}
+
+/**
+ * @brief Detaches the elements from `index` onwards into `suffix` by splitting the tree, in O(log n).
+ * @private
+ */
+void ropeSplitAt(ListHeader *this, int index, ListHeader *suffix){
+    cut(this, suffix, this->_ropeRoot, index, &this->_ropeRoot, &suffix->_ropeRoot);
+    suffix->_length = this->_length - index;
+    this->_length = index;
+}
+
+/**
+ * @brief Copies the slots of the chunks of a subtree, in order, to or from a contiguous array.
+ * @return The address in `items` after the last slot copied.
+ * @private
+ */
+static unsigned char *moveChunks(ListHeader *this, struct RopeNode *node, unsigned char *items, bool scatter){
+    while (node != NULL){
+        items = moveChunks(this, node->_left, items, scatter);
+        size_t bytes = (size_t)node->_used * this->_size;
+        if (scatter) {
+            memcpy(node->_items, items, bytes);
+        } else {
+            memcpy(items, node->_items, bytes);
+        }
+        items += bytes;
+        node = node->_right;
+    }
+    return items;
+}
+
+/**
+ * @brief Copies every slot of the list to or from a contiguous array.
+ * @private
+ */
+static void moveSlots(ListHeader *this, unsigned char *items, bool scatter){
+    moveChunks(this, this->_ropeRoot, items, scatter);
+}
+
+/**
+ * @brief Sorts the list, moving the values between the chunks' slots. The tree is unchanged.
+ * @private
+ */
+void ropeSort(ListHeader *this, const struct SortPlan *plan){
+    sortGathered(this, plan, moveSlots);
+}
+
+/**
+ * @brief Searches the chunks of a subtree whose first element has index `base`.
+ *
+ * Chunks are visited in order, or in reverse order for `FIND_LAST`, so both
+ * stop at the first chunk with a match.
+ * @private
+ */
+static int findIn(ListHeader *this, struct RopeNode *node, int base, const struct SearchPlan *plan){
+    int found = plan->mode == FIND_COUNT ? 0 : -1;
+    while (node != NULL){
+        int start = base + countOf(node->_left);
+        if (plan->mode == FIND_LAST) {
+            int result = findIn(this, node->_right, start + node->_used, plan);
+            if (result >= 0) return result;
+            result = searchSlots(this, node->_items, node->_used, plan);
+            if (result >= 0) return start + result;
+            node = node->_left;
+            continue;
+        }
+        int left = findIn(this, node->_left, base, plan);
+        int here = searchSlots(this, node->_items, node->_used, plan);
+        if (plan->mode == FIND_COUNT) {
+            found += left + here;
+        } else if (left >= 0) {
+            return left;
+        } else if (here >= 0) {
+            return start + here;
+        }
+        base = start + node->_used;
+        node = node->_right;
+    }
+    return found;
+}
+
+/** @private */
+int ropeFind(ListHeader *this, const struct SearchPlan *plan){
+    return findIn(this, this->_ropeRoot, 0, plan);
+}
+
+/** @private */
+const struct ListOps ropeOps = {
+    push, ropePop, ropePrint, len, ropeDestroy, ropeGet, set, ropeDelete, insert, ropePick, ropeForeach,
+    popBack, ropePushValue, ropeSetValue, ropeInsertValue, pushValues,
+    ropeConcat, ropeSplitAt, ropeSort, ropeFind
+};
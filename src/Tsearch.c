@@ -0,0 +1,327 @@
+/**
+ * @file Tsearch.c
+ * @brief Searching a list for elements equal to a value.
+ *
+ * Numbers compare with `==`, `STRING` elements with `strcmp`, `T` elements by
+ * pointer and `RECORD` elements byte by byte, unless a comparator is given.
+ *
+ * Slot arrays of numbers, the whole buffer of an `ARRAY` list or a chunk of an
+ * `UNROLLED` or `ROPE` list, are scanned by loops specialized for each element
+ * width. They test `SEARCH_BLOCK` elements at a time without branching, which
+ * the compiler turns into vector compares, and only look for the exact match
+ * inside a block that has one. `LINKED` chains get specialized loops too;
+ * the other layouts go through their iterator.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Number of elements a slot search compares before branching on the result.
+ * @private
+ */
+#define SEARCH_BLOCK 16
+
+/**
+ * @brief Defines `<name>Slots`, a search of a slot array of `TYPE` values.
+ *
+ * Returns the index of the first or last slot equal to `key`, or -1, or the
+ * number of equal slots, depending on `mode`.
+ * @private
+ */
+#define SLOT_SEARCH(name, TYPE)                                                                   \
+static int name##Slots(const unsigned char *items, int length, const void *key, SearchMode mode){ \
+    const TYPE *values = (const TYPE *)(const void *)items;                                       \
+    TYPE k;                                                                                       \
+    memcpy(&k, key, sizeof(TYPE));                                                                \
+    if (mode == FIND_COUNT) {                                                                     \
+        int count = 0;                                                                            \
+        for (int i = 0; i < length; i++){                                                         \
+            count += values[i] == k;                                                              \
+        }                                                                                         \
+        return count;                                                                             \
+    }                                                                                             \
+    if (mode == FIND_LAST) {                                                                      \
+        int end = length;                                                                         \
+        for (; end >= SEARCH_BLOCK; end -= SEARCH_BLOCK){                                         \
+            int hit = 0;                                                                          \
+            for (int j = end - SEARCH_BLOCK; j < end; j++){                                       \
+                hit |= values[j] == k;                                                            \
+            }                                                                                     \
+            if (hit) break;                                                                       \
+        }                                                                                         \
+        for (int i = end - 1; i >= 0; i--){                                                       \
+            if (values[i] == k) return i;                                                         \
+        }                                                                                         \
+        return -1;                                                                                \
+    }                                                                                             \
+    int start = 0;                                                                                \
+    for (; start + SEARCH_BLOCK <= length; start += SEARCH_BLOCK){                                \
+        int hit = 0;                                                                              \
+        for (int j = start; j < start + SEARCH_BLOCK; j++){                                       \
+            hit |= values[j] == k;                                                                \
+        }                                                                                         \
+        if (hit) break;                                                                           \
+    }                                                                                             \
+    for (int i = start; i < length; i++){                                                         \
+        if (values[i] == k) return i;                                                             \
+    }                                                                                             \
+    return -1;                                                                                    \
+}
+
+/**
+ * @brief Defines `<name>Nodes`, a search of a node chain of `TYPE` values.
+ * @private
+ */
+#define NODE_SEARCH(name, TYPE)                                                                   \
+static int name##Nodes(Node node, const void *key, SearchMode mode){                              \
+    TYPE k;                                                                                       \
+    memcpy(&k, key, sizeof(TYPE));                                                                \
+    int found = mode == FIND_COUNT ? 0 : -1;                                                      \
+    for (int i = 0; node != NULL; node = node->_nextNode, i++){                                   \
+        if (*(const TYPE *)node->_val != k) continue;                                             \
+        if (mode == FIND_COUNT) {                                                                 \
+            found++;                                                                              \
+        } else if (mode == FIND_LAST) {                                                           \
+            found = i;                                                                            \
+        } else {                                                                                  \
+            return i;                                                                             \
+        }                                                                                         \
+    }                                                                                             \
+    return found;                                                                                 \
+}
+
+SLOT_SEARCH(search8, uint8_t)
+SLOT_SEARCH(search16, uint16_t)
+SLOT_SEARCH(search32, uint32_t)
+SLOT_SEARCH(search64, uint64_t)
+SLOT_SEARCH(searchFloat, float)
+SLOT_SEARCH(searchDouble, double)
+
+NODE_SEARCH(search8, uint8_t)
+NODE_SEARCH(search16, uint16_t)
+NODE_SEARCH(search32, uint32_t)
+NODE_SEARCH(search64, uint64_t)
+NODE_SEARCH(searchFloat, float)
+NODE_SEARCH(searchDouble, double)
+
+/**
+ * @brief Tells whether an element equals the key of a search.
+ * @param val The element, as `get` would return it.
+ * @private
+ */
+static bool matches(ListHeader *this, const struct SearchPlan *plan, const void *val){
+    if (plan->compare != NULL) return plan->compare(plan->key, val) == 0;
+    switch (this->_type){
+        case FLOAT:  return *(const float *)val == *(const float *)plan->key;
+        case DOUBLE: return *(const double *)val == *(const double *)plan->key;
+        case STRING: return strcmp(val, plan->key) == 0;
+        case T:      return val == plan->key;
+        default:     return memcmp(val, plan->key, this->_size) == 0;
+    }
+}
+
+/**
+ * @brief Picks the specialized loop for a search.
+ *
+ * Integers of every type are equal exactly when their bytes are, so they only
+ * need one loop per width, returned in bytes. `FLOAT` and `DOUBLE` get their
+ * own, since `==` on them is not a byte comparison, returned as the negated
+ * width. 0 means there is no specialized loop.
+ * @private
+ */
+static int searchWidth(ListHeader *this, const struct SearchPlan *plan){
+    if (plan->compare != NULL) return 0;
+    switch (this->_type){
+        case STRING: case T: case RECORD: return 0;
+        case FLOAT:  return -4;
+        case DOUBLE: return -8;
+        default:     return (int)this->_size;
+    }
+}
+
+/** @copydoc searchSlots */
+int searchSlots(ListHeader *this, const unsigned char *items, int length, const struct SearchPlan *plan){
+    switch (searchWidth(this, plan)){
+        case 1:  return search8Slots(items, length, plan->key, plan->mode);
+        case 2:  return search16Slots(items, length, plan->key, plan->mode);
+        case 4:  return search32Slots(items, length, plan->key, plan->mode);
+        case 8:  return search64Slots(items, length, plan->key, plan->mode);
+        case -4: return searchFloatSlots(items, length, plan->key, plan->mode);
+        case -8: return searchDoubleSlots(items, length, plan->key, plan->mode);
+        default: break;
+    }
+    int found = plan->mode == FIND_COUNT ? 0 : -1;
+    if (plan->mode == FIND_LAST) {
+        for (int i = length - 1; i >= 0; i--){
+            if (matches(this, plan, slotValue(this, (unsigned char *)items + (size_t)i * this->_size))) return i;
+        }
+        return found;
+    }
+    for (int i = 0; i < length; i++){
+        if (!matches(this, plan, slotValue(this, (unsigned char *)items + (size_t)i * this->_size))) continue;
+        if (plan->mode != FIND_COUNT) return i;
+        found++;
+    }
+    return found;
+}
+
+/** @copydoc searchNodes */
+int searchNodes(ListHeader *this, Node head, const struct SearchPlan *plan){
+    switch (searchWidth(this, plan)){
+        case 1:  return search8Nodes(head, plan->key, plan->mode);
+        case 2:  return search16Nodes(head, plan->key, plan->mode);
+        case 4:  return search32Nodes(head, plan->key, plan->mode);
+        case 8:  return search64Nodes(head, plan->key, plan->mode);
+        case -4: return searchFloatNodes(head, plan->key, plan->mode);
+        case -8: return searchDoubleNodes(head, plan->key, plan->mode);
+        default: break;
+    }
+    int found = plan->mode == FIND_COUNT ? 0 : -1;
+    for (int i = 0; head != NULL; head = head->_nextNode, i++){
+        if (!matches(this, plan, head->_val)) continue;
+        if (plan->mode == FIND_COUNT) {
+            found++;
+        } else if (plan->mode == FIND_LAST) {
+            found = i;
+        } else {
+            return i;
+        }
+    }
+    return found;
+}
+
+/** @copydoc searchValues */
+int searchValues(ListHeader *this, const struct SearchPlan *plan){
+    struct TIterator iterator;
+    startIterator(&iterator, this, this->_extras->_allocator);
+    int found = plan->mode == FIND_COUNT ? 0 : -1;
+    for (int i = 0; iterator.hasNext(&iterator); i++){
+        if (!matches(this, plan, iterator.next(&iterator))) continue;
+        if (plan->mode == FIND_COUNT) {
+            found++;
+        } else if (plan->mode == FIND_LAST) {
+            found = i;
+        } else {
+            return i;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Runs a search on a list, reading the key from the variadic arguments.
+ * @private
+ */
+static int search(ListHeader *this, const char *caller, SearchMode mode, va_list *args){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return mode == FIND_COUNT ? 0 : -1;
+    }
+    Scalar buf;
+    struct SearchPlan plan = { readValue(this, args, &buf), NULL, mode };
+    if ((this->_type == STRING || this->_type == RECORD) && plan.key == NULL) {
+        fprintf(stderr, "Error in %s(): Cannot search for a NULL string or record.\n", caller);
+        return mode == FIND_COUNT ? 0 : -1;
+    }
+    return this->ops->_find(this, &plan);
+}
+
+/** @copydoc indexOf */
+int indexOf(List list, ...){
+    va_list args;
+    va_start(args, list);
+    int index = search(headerOf(list), "indexOf", FIND_FIRST, &args);
+    va_end(args);
+    return index;
+}
+
+/** @copydoc indexOfHeader */
+int indexOfHeader(ListHeader *header, ...){
+    va_list args;
+    va_start(args, header);
+    int index = search(header, "indexOfHeader", FIND_FIRST, &args);
+    va_end(args);
+    return index;
+}
+
+/** @copydoc lastIndexOf */
+int lastIndexOf(List list, ...){
+    va_list args;
+    va_start(args, list);
+    int index = search(headerOf(list), "lastIndexOf", FIND_LAST, &args);
+    va_end(args);
+    return index;
+}
+
+/** @copydoc lastIndexOfHeader */
+int lastIndexOfHeader(ListHeader *header, ...){
+    va_list args;
+    va_start(args, header);
+    int index = search(header, "lastIndexOfHeader", FIND_LAST, &args);
+    va_end(args);
+    return index;
+}
+
+/** @copydoc contains */
+bool contains(List list, ...){
+    va_list args;
+    va_start(args, list);
+    int index = search(headerOf(list), "contains", FIND_ANY, &args);
+    va_end(args);
+    return index >= 0;
+}
+
+/** @copydoc containsHeader */
+bool containsHeader(ListHeader *header, ...){
+    va_list args;
+    va_start(args, header);
+    int index = search(header, "containsHeader", FIND_ANY, &args);
+    va_end(args);
+    return index >= 0;
+}
+
+/** @copydoc count */
+int count(List list, ...){
+    va_list args;
+    va_start(args, list);
+    int found = search(headerOf(list), "count", FIND_COUNT, &args);
+    va_end(args);
+    return found;
+}
+
+/** @copydoc countHeader */
+int countHeader(ListHeader *header, ...){
+    va_list args;
+    va_start(args, header);
+    int found = search(header, "countHeader", FIND_COUNT, &args);
+    va_end(args);
+    return found;
+}
+
+/**
+ * @brief Runs a search with a comparator on a list.
+ * @private
+ */
+static int searchWith(ListHeader *this, const char *caller, const void *key, int (*compare)(const void *a, const void *b)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return -1;
+    }
+    if (compare == NULL) {
+        fprintf(stderr, "Error in %s(): The comparator is NULL.\n", caller);
+        return -1;
+    }
+    struct SearchPlan plan = { key, compare, FIND_FIRST };
+    return this->ops->_find(this, &plan);
+}
+
+/** @copydoc indexOfWith */
+int indexOfWith(List list, const void *key, int (*compare)(const void *a, const void *b)){
+    return searchWith(headerOf(list), "indexOfWith", key, compare);
+}
+
+/** @copydoc indexOfWithHeader */
+int indexOfWithHeader(ListHeader *header, const void *key, int (*compare)(const void *a, const void *b)){
+    return searchWith(header, "indexOfWithHeader", key, compare);
+}
@@ -0,0 +1,452 @@
+/**
+ * @file Tskiplist.c
+ * @brief Implementation of the `SKIPLIST` list layout.
+ *
+ * An indexable skip list: every node is linked on level 0 and, with
+ * probability 1/4 per level, on the levels above it. Each link also records
+ * its span, the number of level-0 steps it skips, so a position is reached by
+ * descending from the top level while summing spans. `get`, `set`, `insert`,
+ * `remove` and `pick` are O(log n) expected, and iteration walks level 0.
+ *
+ * Spans count ranks, where the sentinel head has rank 0 and element `i` has
+ * rank `i + 1`. A link with no successor spans to the end of the list.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Returns the offset of the value slot in a node with `height` levels.
+ *
+ * The slot follows the links, rounded up to `max_align_t` alignment like the
+ * element storage of `UNROLLED` and `ROPE` chunks.
+ * @private
+ */
+static size_t valueOffset(int height){
+    size_t offset = sizeof(struct SkipNode) + (size_t)height * sizeof(struct SkipLink);
+    return (offset + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1);
+}
+
+/**
+ * @brief Returns the address of a node's value, stored after its links.
+ * @private
+ */
+static unsigned char *valueOf(struct SkipNode *node){
+    return (unsigned char *)node + valueOffset(node->_height);
+}
+
+/**
+ * @brief Draws the height of a new node: 1, then one more level with probability 1/4.
+ * @private
+ */
+static int randomHeight(ListHeader *this){
+    int height = 1;
+    while (height < SKIPLIST_MAX_LEVEL){
+        unsigned int x = this->_skipSeed;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        this->_skipSeed = x;
+        if ((x & 3) != 0) break;
+        height++;
+    }
+    return height;
+}
+
+/**
+ * @brief Allocates a node with `height` levels of links.
+ * @private
+ */
+static struct SkipNode *newSkipNode(ListHeader *this, int height){
+    struct SkipNode *node = allocate(this, valueOffset(height) + this->_size);
+    if (node == NULL) {
+        fprintf(stderr, "Error in newSkipNode(): Failed to allocate memory for a new node.\n");
+        exit(EXIT_FAILURE);
+    }
+    node->_height = height;
+    return node;
+}
+
+/**
+ * @brief Finds the last node on each level whose rank is at most `rank`.
+ * @param this A pointer to the list.
+ * @param rank The rank to stop at.
+ * @param update Receives the node found on each level in use.
+ * @param ranks Receives the rank of each of those nodes.
+ * @private
+ */
+static void descend(ListHeader *this, int rank, struct SkipNode **update, int *ranks){
+    struct SkipNode *node = this->_skipHead;
+    int position = 0;
+    for (int level = this->_skipLevel - 1; level >= 0; level--){
+        while (node->_links[level]._next != NULL && position + node->_links[level]._span <= rank){
+            position += node->_links[level]._span;
+            node = node->_links[level]._next;
+        }
+        update[level] = node;
+        ranks[level] = position;
+    }
+}
+
+/**
+ * @brief Returns the node at a position. The index must be in bounds.
+ * @private
+ */
+static struct SkipNode *nodeAt(ListHeader *this, int index){
+    struct SkipNode *node = this->_skipHead;
+    int position = 0;
+    for (int level = this->_skipLevel - 1; level >= 0; level--){
+        while (node->_links[level]._next != NULL && position + node->_links[level]._span <= index + 1){
+            position += node->_links[level]._span;
+            node = node->_links[level]._next;
+        }
+        if (position == index + 1) break;
+    }
+    return node;
+}
+
+/**
+ * @brief Returns the node at a position, for iterators starting mid-list. The index must be in bounds.
+ * @private
+ */
+struct SkipNode *skiplistNodeAt(ListHeader *this, int index){
+    return nodeAt(this, index);
+}
+
+/**
+ * @brief Unlinks the node at a position from every level, without releasing it.
+ *
+ * The index must be in bounds.
+ * @private
+ */
+static struct SkipNode *unlink(ListHeader *this, int index){
+    struct SkipNode *update[SKIPLIST_MAX_LEVEL] = { NULL };
+    int ranks[SKIPLIST_MAX_LEVEL];
+    descend(this, index, update, ranks);
+    struct SkipNode *node = update[0]->_links[0]._next;
+    for (int level = 0; level < this->_skipLevel; level++){
+        struct SkipLink *link = &update[level]->_links[level];
+        if (link->_next == node) {
+            link->_span += node->_links[level]._span - 1;
+            link->_next = node->_links[level]._next;
+        } else {
+            link->_span--;
+        }
+    }
+    while (this->_skipLevel > 1 && this->_skipHead->_links[this->_skipLevel - 1]._next == NULL){
+        this->_skipLevel--;
+    }
+    this->_length--;
+    return node;
+}
+
+/**
+ * @brief Prints the contents of the list to standard output.
+ * @param this A pointer to the list.
+ * @private
+ */
+void skiplistPrint(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
+        return;
+    }
+    printf("[");
+    if (this->_skipHead != NULL) {
+        for (struct SkipNode *node = this->_skipHead->_links[0]._next; node != NULL; node = node->_links[0]._next){
+            printValue(this, slotValue(this, valueOf(node)));
+            if (node->_links[0]._next != NULL){
+                printf(", ");
+            }
+        }
+    }
+    printf("]");
+    printf("\n");
+}
+
+/**
+ * @brief Frees all the nodes in the list and the strings they own.
+ *
+ * As with the `LINKED` layout, pointers stored in a `T` list are not freed.
+ * This function does NOT free the `List` struct itself.
+ * @param this A pointer to the list.
+ * @private
+ */
+void skiplistDestroy(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (this->_skipHead != NULL) {
+        struct SkipNode *node = this->_skipHead->_links[0]._next;
+        while (node != NULL){
+            struct SkipNode *temp = node;
+            node = temp->_links[0]._next;
+            if (this->_type == STRING && !this->_extras->_stringArena) {
+                releaseSlot(this, valueOf(temp));
+            }
+            deallocate(this, temp);
+        }
+        deallocate(this, this->_skipHead);
+    }
+    releaseExtras(this);
+    this->_skipHead = NULL;
+    this->_skipLevel = 0;
+    this->_length = 0;
+}
+
+/**
+ * @brief Inserts a new element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void skiplistInsertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
+    }
+    if (this->_skipHead == NULL) {
+        struct SkipNode *head = newSkipNode(this, SKIPLIST_MAX_LEVEL);
+        for (int level = 0; level < SKIPLIST_MAX_LEVEL; level++){
+            head->_links[level]._next = NULL;
+            head->_links[level]._span = 0;
+        }
+        this->_skipHead = head;
+        this->_skipLevel = 1;
+    }
+
+    struct SkipNode *update[SKIPLIST_MAX_LEVEL];
+    int ranks[SKIPLIST_MAX_LEVEL];
+    descend(this, index, update, ranks);
+
+    int height = randomHeight(this);
+    if (height > this->_skipLevel) {
+        for (int level = this->_skipLevel; level < height; level++){
+            update[level] = this->_skipHead;
+            ranks[level] = 0;
+            this->_skipHead->_links[level]._next = NULL;
+            this->_skipHead->_links[level]._span = this->_length;
+        }
+        this->_skipLevel = height;
+    }
+
+    struct SkipNode *node = newSkipNode(this, height);
+    storeValue(this, valueOf(node), val);
+    for (int level = 0; level < height; level++){
+        struct SkipLink *link = &update[level]->_links[level];
+        node->_links[level]._next = link->_next;
+        node->_links[level]._span = link->_span - (index - ranks[level]);
+        link->_next = node;
+        link->_span = index - ranks[level] + 1;
+    }
+    for (int level = height; level < this->_skipLevel; level++){
+        update[level]->_links[level]._span++;
+    }
+    this->_length++;
+}
+
+/**
+ * @brief Adds a new element to the end of the list in O(log n).
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void skiplistPushValue(ListHeader *this, void *val){
+    skiplistInsertValue(this, this->_length, val);
+}
+
+/**
+ * @brief Removes the first element of the list and returns its value.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *skiplistPop(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_length == 0) {
+        return NULL;
+    }
+    struct SkipNode *node = unlink(this, 0);
+    void *val = takeSlot(this, valueOf(node));
+    deallocate(this, node);
+    return val;
+}
+
+/**
+ * @brief Retrieves a pointer to the element at a specific index in O(log n).
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to retrieve.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *skiplistGet(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    return slotValue(this, valueOf(nodeAt(this, index)));
+}
+
+/**
+ * @brief Updates the value of an element at a specific index in O(log n).
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void skiplistSetValue(ListHeader *this, int index, void *val){
+    if (index < 0) {
+        fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    unsigned char *slot = valueOf(nodeAt(this, index));
+    releaseSlot(this, slot);
+    storeValue(this, slot, val);
+}
+
+/**
+ * @brief Deletes the element at a specific index in O(log n), freeing the string it owns.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to delete.
+ * @private
+ */
+void skiplistDelete(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    struct SkipNode *node = unlink(this, index);
+    releaseSlot(this, valueOf(node));
+    deallocate(this, node);
+}
+
+/**
+ * @brief Removes and returns the element at a specific index in O(log n).
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to remove.
+ * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *skiplistPick(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    struct SkipNode *node = unlink(this, index);
+    void *val = takeSlot(this, valueOf(node));
+    deallocate(this, node);
+    return val;
+}
+
+/**
+ * @brief Applies a given function to each element in the list.
+ * @param this A pointer to the list.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ * @private
+ */
+void skiplistForeach(ListHeader *this, void(*function)(void*)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (this->_skipHead == NULL) return;
+    for (struct SkipNode *node = this->_skipHead->_links[0]._next; node != NULL; node = node->_links[0]._next){
+        function(slotValue(this, valueOf(node)));
+    }
+}
+
+/**
+ * @brief Returns the next element of a `SKIPLIST` list iteration.
+ * @param iterator A pointer to the iterator.
+ * @return A pointer to the next element's value, or `NULL` if the end is reached or the iterator is invalid.
+ * @private
+ */
+void *skiplistNext(TIterator iterator){
+    if (iterator == NULL || iterator->_skip == NULL) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    struct SkipNode *node = iterator->_skip;
+    iterator->_index++;
+    iterator->_skip = node->_links[0]._next;
+    return slotValue(iterator->_list, valueOf(node));
+}
+
+/**
+ * @brief Checks if a `SKIPLIST` list iteration has more elements.
+ * @param iterator A pointer to the iterator.
+ * @return `true` if there is at least one more element to iterate over, `false` otherwise.
+ * @private
+ */
+bool skiplistHasNext(TIterator iterator){
+    if (iterator == NULL) {
+        return false;
+    }
+    return iterator->_skip != NULL;
+}
+
+/**
+ * @brief Copies the value of every node, in list order, to or from a contiguous array.
+ * @private
+ */
+static void moveSlots(ListHeader *this, unsigned char *items, bool scatter){
+    for (struct SkipNode *node = this->_skipHead->_links[0]._next; node != NULL; node = node->_links[0]._next){
+        if (scatter) {
+            memcpy(valueOf(node), items, this->_size);
+        } else {
+            memcpy(items, valueOf(node), this->_size);
+        }
+        items += this->_size;
+    }
+}
+
+/**
+ * @brief Sorts the list, moving the values between the nodes. The links and spans are unchanged.
+ * @private
+ */
+void skiplistSort(ListHeader *this, const struct SortPlan *plan){
+    sortGathered(this, plan, moveSlots);
+}
+
+/** @private */
+const struct ListOps skiplistOps = {
+    push, skiplistPop, skiplistPrint, len, skiplistDestroy, skiplistGet, set, skiplistDelete, insert, skiplistPick, skiplistForeach,
+    popBack, skiplistPushValue, skiplistSetValue, skiplistInsertValue, pushValues,
+    concatValues, splitValues, skiplistSort, searchValues
+};
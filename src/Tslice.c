@@ -0,0 +1,160 @@
+/**
+ * @file Tslice.c
+ * @brief Read-only views of a range of consecutive list elements.
+ *
+ * A slice remembers the list, the range and an iterator state positioned at
+ * the first element of the range, so walking the slice costs only its own
+ * length. Nothing is copied: `get`, `foreach` and the slice iterator return
+ * pointers into the list's storage.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Reports a slice whose list had elements added, removed or moved since it was taken.
+ *
+ * The length is compared too, for bare headers changed through their `ops`,
+ * which do not bump `_version`.
+ * @private
+ */
+static bool stale(ListSlice slice, const char *caller){
+    const ListHeader *header = slice->_first._list;
+    if (header->_version != slice->_version || header->_length != slice->_listLength) {
+        fprintf(stderr, "Error in %s(): The list was modified after the slice was taken.\n", caller);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Takes a slice of a list.
+ * @private
+ */
+static ListSlice sliceOf(ListHeader *header, const char *caller, int start, int length){
+    if (header == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return NULL;
+    }
+    if (start < 0 || length < 0 || start > header->_length - length) {
+        fprintf(stderr, "Error in %s(): Range [%d, %d + %d) is out of bounds for list of size %d.\n",
+                caller, start, start, length, header->_length);
+        return NULL;
+    }
+    const ListAllocator *allocator = header->_extras->_allocator;
+    ListSlice slice = allocator == NULL ? malloc(sizeof(struct ListSlice))
+                                        : allocator->malloc(allocator->context, sizeof(struct ListSlice));
+    if (slice == NULL) {
+        fprintf(stderr, "Error in %s(): Failed to allocate memory for the new slice.\n", caller);
+        exit(EXIT_FAILURE);
+    }
+    startIterator(&slice->_first, header, allocator);
+    if (length > 0) advanceIterator(&slice->_first, start);
+    slice->_start = start;
+    slice->_length = length;
+    slice->_version = header->_version;
+    slice->_listLength = header->_length;
+    return slice;
+}
+
+/** @copydoc newSlice */
+ListSlice newSlice(List list, int start, int length){
+    return sliceOf(headerOf(list), "newSlice", start, length);
+}
+
+/** @copydoc newSliceHeader */
+ListSlice newSliceHeader(ListHeader *header, int start, int length){
+    return sliceOf(header, "newSliceHeader", start, length);
+}
+
+/** @copydoc sliceLen */
+int sliceLen(ListSlice slice){
+    if (slice == NULL) {
+        fprintf(stderr, "Error in sliceLen(): The provided slice is NULL.\n");
+        return 0;
+    }
+    return slice->_length;
+}
+
+/** @copydoc sliceGet */
+void *sliceGet(ListSlice slice, int index){
+    if (slice == NULL) {
+        fprintf(stderr, "Error in sliceGet(): The provided slice is NULL.\n");
+        return NULL;
+    }
+    if (index < 0 || index >= slice->_length) {
+        fprintf(stderr, "Error in sliceGet(): Index %d is out of bounds for slice of size %d.\n", index, slice->_length);
+        return NULL;
+    }
+    if (stale(slice, "sliceGet")) return NULL;
+    struct TIterator iterator = slice->_first;
+    advanceIterator(&iterator, index);
+    return iterator.next(&iterator);
+}
+
+/** @copydoc sliceForeach */
+void sliceForeach(ListSlice slice, void(*function)(void*)){
+    if (slice == NULL) {
+        fprintf(stderr, "Error in sliceForeach(): The provided slice is NULL.\n");
+        return;
+    }
+    if (stale(slice, "sliceForeach")) return;
+    struct TIterator iterator = slice->_first;
+    for (int i = 0; i < slice->_length; i++){
+        function(iterator.next(&iterator));
+    }
+}
+
+/**
+ * @brief Returns the next element of a slice iteration.
+ * @private
+ */
+static void *sliceNext(TIterator iterator){
+    if (iterator == NULL || iterator->_remaining <= 0) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    iterator->_remaining--;
+    return iterator->_step(iterator);
+}
+
+/**
+ * @brief Checks if a slice iteration has more elements.
+ * @private
+ */
+static bool sliceHasNext(TIterator iterator){
+    if (iterator == NULL) {
+        return false;
+    }
+    return iterator->_remaining > 0;
+}
+
+/** @copydoc newSliceIterator */
+TIterator newSliceIterator(ListSlice slice){
+    if (slice == NULL) {
+        fprintf(stderr, "Error in newSliceIterator(): The provided slice is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+    const ListAllocator *allocator = slice->_first._allocator;
+    TIterator iterator = allocator == NULL ? malloc(sizeof(struct TIterator))
+                                           : allocator->malloc(allocator->context, sizeof(struct TIterator));
+    if (iterator == NULL) {
+        fprintf(stderr, "Error in newSliceIterator(): Failed to allocate memory for the new iterator.\n");
+        exit(EXIT_FAILURE);
+    }
+    *iterator = slice->_first;
+    iterator->_remaining = stale(slice, "newSliceIterator") ? 0 : slice->_length;
+    iterator->_step = iterator->next;
+    iterator->next = sliceNext;
+    iterator->hasNext = sliceHasNext;
+    return iterator;
+}
+
+/** @copydoc freeSlice */
+void freeSlice(ListSlice slice){
+    if (slice != NULL && slice->_first._allocator != NULL) {
+        slice->_first._allocator->free(slice->_first._allocator->context, slice);
+        return;
+    }
+    free(slice);
+}
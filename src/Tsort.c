@@ -0,0 +1,795 @@
+/**
+ * @file Tsort.c
+ * @brief Stable merge sort of list elements.
+ *
+ * Node chains (`LINKED`, and `DOUBLY` once its links are straightened) are
+ * sorted by a bottom-up merge that relinks the nodes and moves no value, in
+ * O(1) extra memory. Elements stored in slots are sorted as a contiguous slot
+ * array with one scratch buffer: in place for `ARRAY`, and gathered from and
+ * scattered back to the nodes or chunks of the other layouts.
+ *
+ * `radixSort` replaces the comparisons of numeric lists with an LSD radix sort
+ * over order-preserving unsigned keys, on the same chains and slot arrays.
+ *
+ * Each built-in type gets its own copy of both algorithms, generated by
+ * `NODE_SORT` and `SLOT_SORT`, so comparisons compile to a direct `<` or `strcmp` instead
+ * of a call through a function pointer. Only `T` and `RECORD` lists, or an
+ * explicit comparator, pay for an indirect call per comparison.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+#include <pthread.h>
+#include <math.h>
+
+/**
+ * @brief Length of the runs sorted by insertion before slot arrays are merged.
+ * @private
+ */
+#define SORT_RUN 16
+
+/** @private Reads the value of a slot holding the value itself. */
+#define SLOT_VALUE(slot) ((const void *)(slot))
+/** @private Reads the value of a slot holding a pointer, for `STRING` and `T`. */
+#define SLOT_POINTER(slot) (*(void *const *)(slot))
+
+/** @private */
+#define LESS_INT(a, b) (*(const int *)(a) < *(const int *)(b))
+/** @private */
+#define LESS_FLOAT(a, b) lessReal(*(const float *)(a), *(const float *)(b))
+/** @private */
+#define LESS_DOUBLE(a, b) lessReal(*(const double *)(a), *(const double *)(b))
+/** @private */
+#define LESS_INT8(a, b) (*(const int8_t *)(a) < *(const int8_t *)(b))
+/** @private */
+#define LESS_INT16(a, b) (*(const int16_t *)(a) < *(const int16_t *)(b))
+/** @private */
+#define LESS_INT32(a, b) (*(const int32_t *)(a) < *(const int32_t *)(b))
+/** @private */
+#define LESS_INT64(a, b) (*(const int64_t *)(a) < *(const int64_t *)(b))
+/** @private */
+#define LESS_UINT8(a, b) (*(const uint8_t *)(a) < *(const uint8_t *)(b))
+/** @private */
+#define LESS_UINT16(a, b) (*(const uint16_t *)(a) < *(const uint16_t *)(b))
+/** @private */
+#define LESS_UINT32(a, b) (*(const uint32_t *)(a) < *(const uint32_t *)(b))
+/** @private */
+#define LESS_UINT64(a, b) (*(const uint64_t *)(a) < *(const uint64_t *)(b))
+/** @private */
+#define LESS_STRING(a, b) (strcmp((const char *)(a), (const char *)(b)) < 0)
+/** @private */
+#define LESS_USER(a, b) (compare((a), (b)) < 0)
+
+/**
+ * @brief Places NaNs below (-1) or above (1) every number by their sign, and numbers at 0.
+ * @private
+ */
+static inline int nanRank(double x){
+    if (x == x) return 0;
+    return signbit(x) ? -1 : 1;
+}
+
+/**
+ * @brief Orders `FLOAT` and `DOUBLE` values with NaNs at the ends, as `radixSort` does.
+ *
+ * A raw `<` is false both ways for a NaN, which is not a strict weak order and
+ * leaves the merge with an unsorted result. Numbers compare with `<`, so -0.0
+ * and 0.0 stay equal, and NaNs with the sign bit set come first, the others last.
+ * @private
+ */
+static inline bool lessReal(double a, double b){
+    if (a < b) return true;
+    if (a == a && b == b) return false;
+    return nanRank(a) < nanRank(b);
+}
+
+/**
+ * @brief Number of pending runs kept by a node sort; run `k` holds 2^k nodes.
+ * @private
+ */
+#define SORT_BINS 32
+
+/**
+ * @brief Defines `<name>Nodes`, a merge sort of a node chain ordering values with `LESS`.
+ *
+ * Nodes are taken one at a time and merged into pending runs of 1, 2, 4, ...
+ * nodes, like binary addition, so merges work on recently touched nodes while
+ * they are still in cache. The sort is stable: the older run is always the
+ * left side of a merge, and a node only moves before an equal one that
+ * preceded it when `LESS` says it is strictly smaller.
+ * @private
+ */
+#define NODE_SORT(name, LESS)                                                                     \
+static Node name##Merge(Node a, Node b, int (*compare)(const void *, const void *)){              \
+    (void)compare;                                                                                \
+    Node head = NULL;                                                                             \
+    Node *link = &head;                                                                           \
+    while (a != NULL && b != NULL){                                                               \
+        if (LESS(b->_val, a->_val)) {                                                             \
+            *link = b;                                                                            \
+            b = b->_nextNode;                                                                     \
+        } else {                                                                                  \
+            *link = a;                                                                            \
+            a = a->_nextNode;                                                                     \
+        }                                                                                         \
+        link = &(*link)->_nextNode;                                                               \
+    }                                                                                             \
+    *link = a != NULL ? a : b;                                                                    \
+    return head;                                                                                  \
+}                                                                                                 \
+                                                                                                  \
+static Node name##Nodes(Node head, Node *tail, int (*compare)(const void *, const void *)){      \
+    Node bins[SORT_BINS] = { NULL };                                                              \
+    int used = 0;                                                                                 \
+    while (head != NULL){                                                                         \
+        Node run = head;                                                                          \
+        head = head->_nextNode;                                                                   \
+        run->_nextNode = NULL;                                                                    \
+        int k = 0;                                                                                \
+        for (; k < used && bins[k] != NULL; k++){                                                 \
+            run = name##Merge(bins[k], run, compare);                                             \
+            bins[k] = NULL;                                                                       \
+        }                                                                                         \
+        if (k == used) used++;                                                                    \
+        bins[k] = run;                                                                            \
+    }                                                                                             \
+    for (int k = 0; k < used; k++){                                                               \
+        if (bins[k] != NULL) head = name##Merge(bins[k], head, compare);                          \
+    }                                                                                             \
+    Node last = head;                                                                             \
+    while (last != NULL && last->_nextNode != NULL){                                              \
+        last = last->_nextNode;                                                                   \
+    }                                                                                             \
+    *tail = last;                                                                                 \
+    return head;                                                                                  \
+}
+
+/**
+ * @brief Defines `<name>Slots`, a stable merge sort of a slot array ordering values with `LESS`.
+ *
+ * `ACCESS` turns a slot address into the value pointer `LESS` compares. Runs of
+ * `SORT_RUN` slots are insertion sorted, then merged back and forth between
+ * the array and the scratch buffer by `<name>SlotMerge`. `<name>SlotSplit`
+ * returns how many of the first `k` merged slots come from `a`, so that a
+ * merge can be cut into independent pieces.
+ * @private
+ */
+#define SLOT_SORT(name, ACCESS, LESS)                                                             \
+static void name##SlotMerge(const unsigned char *a, int na, const unsigned char *b, int nb,       \
+                            unsigned char *out, size_t size,                                      \
+                            int (*compare)(const void *, const void *)){                          \
+    (void)compare;                                                                                \
+    int i = 0, j = 0;                                                                             \
+    while (i < na && j < nb){                                                                     \
+        if (LESS(ACCESS(b + (size_t)j * size), ACCESS(a + (size_t)i * size))) {                   \
+            memcpy(out, b + (size_t)j++ * size, size);                                            \
+        } else {                                                                                  \
+            memcpy(out, a + (size_t)i++ * size, size);                                            \
+        }                                                                                         \
+        out += size;                                                                              \
+    }                                                                                             \
+    memcpy(out, a + (size_t)i * size, (size_t)(na - i) * size);                                   \
+    out += (size_t)(na - i) * size;                                                               \
+    memcpy(out, b + (size_t)j * size, (size_t)(nb - j) * size);                                   \
+}                                                                                                 \
+                                                                                                  \
+static int name##SlotSplit(const unsigned char *a, int na, const unsigned char *b, int nb,        \
+                          int k, size_t size, int (*compare)(const void *, const void *)){        \
+    (void)compare;                                                                                \
+    int lo = k > nb ? k - nb : 0;                                                                 \
+    int hi = k < na ? k : na;                                                                     \
+    while (lo < hi){                                                                              \
+        int i = lo + (hi - lo) / 2;                                                               \
+        int j = k - i;                                                                            \
+        if (j > 0 && !LESS(ACCESS(b + (size_t)(j - 1) * size), ACCESS(a + (size_t)i * size))) {   \
+            lo = i + 1;                                                                           \
+        } else {                                                                                  \
+            hi = i;                                                                               \
+        }                                                                                         \
+    }                                                                                             \
+    return lo;                                                                                    \
+}                                                                                                 \
+                                                                                                  \
+static void name##Slots(unsigned char *items, unsigned char *scratch, int length, size_t size,    \
+                        int (*compare)(const void *, const void *)){                              \
+    for (int start = 0; start < length; start += SORT_RUN){                                       \
+        int end = start + SORT_RUN < length ? start + SORT_RUN : length;                          \
+        for (int i = start + 1; i < end; i++){                                                    \
+            memcpy(scratch, items + (size_t)i * size, size);                                      \
+            int j = i;                                                                            \
+            while (j > start && LESS(ACCESS(scratch), ACCESS(items + (size_t)(j - 1) * size))){   \
+                memcpy(items + (size_t)j * size, items + (size_t)(j - 1) * size, size);           \
+                j--;                                                                              \
+            }                                                                                     \
+            memcpy(items + (size_t)j * size, scratch, size);                                      \
+        }                                                                                         \
+    }                                                                                             \
+    unsigned char *from = items;                                                                  \
+    unsigned char *to = scratch;                                                                  \
+    for (int width = SORT_RUN; width < length; width *= 2){                                       \
+        for (int lo = 0; lo < length; lo += 2 * width){                                           \
+            int mid = lo + width < length ? lo + width : length;                                  \
+            int hi = mid + width < length ? mid + width : length;                                 \
+            name##SlotMerge(from + (size_t)lo * size, mid - lo, from + (size_t)mid * size, hi - mid,\
+                            to + (size_t)lo * size, size, compare);                               \
+        }                                                                                         \
+        unsigned char *swap = from;                                                               \
+        from = to;                                                                                \
+        to = swap;                                                                                \
+    }                                                                                             \
+    if (from != items) memcpy(items, from, (size_t)length * size);                                \
+}
+
+NODE_SORT(sortInt, LESS_INT)
+NODE_SORT(sortFloat, LESS_FLOAT)
+NODE_SORT(sortDouble, LESS_DOUBLE)
+NODE_SORT(sortInt8, LESS_INT8)
+NODE_SORT(sortInt16, LESS_INT16)
+NODE_SORT(sortInt32, LESS_INT32)
+NODE_SORT(sortInt64, LESS_INT64)
+NODE_SORT(sortUint8, LESS_UINT8)
+NODE_SORT(sortUint16, LESS_UINT16)
+NODE_SORT(sortUint32, LESS_UINT32)
+NODE_SORT(sortUint64, LESS_UINT64)
+NODE_SORT(sortString, LESS_STRING)
+NODE_SORT(sortUser, LESS_USER)
+
+SLOT_SORT(sortInt, SLOT_VALUE, LESS_INT)
+SLOT_SORT(sortFloat, SLOT_VALUE, LESS_FLOAT)
+SLOT_SORT(sortDouble, SLOT_VALUE, LESS_DOUBLE)
+SLOT_SORT(sortInt8, SLOT_VALUE, LESS_INT8)
+SLOT_SORT(sortInt16, SLOT_VALUE, LESS_INT16)
+SLOT_SORT(sortInt32, SLOT_VALUE, LESS_INT32)
+SLOT_SORT(sortInt64, SLOT_VALUE, LESS_INT64)
+SLOT_SORT(sortUint8, SLOT_VALUE, LESS_UINT8)
+SLOT_SORT(sortUint16, SLOT_VALUE, LESS_UINT16)
+SLOT_SORT(sortUint32, SLOT_VALUE, LESS_UINT32)
+SLOT_SORT(sortUint64, SLOT_VALUE, LESS_UINT64)
+SLOT_SORT(sortString, SLOT_POINTER, LESS_STRING)
+SLOT_SORT(sortUserValue, SLOT_VALUE, LESS_USER)
+SLOT_SORT(sortUserPointer, SLOT_POINTER, LESS_USER)
+
+/**
+ * @brief Returns how many bytes of a radix key are significant for a type.
+ * @private
+ */
+static int keyBytes(Type type){
+    switch (type){
+        case INT8: case UINT8:   return 1;
+        case INT16: case UINT16: return 2;
+        case DOUBLE: case INT64: case UINT64: return 8;
+        default: return 4;
+    }
+}
+
+/**
+ * @brief Maps a numeric value to an unsigned key with the same order.
+ *
+ * Signed integers have their sign bit flipped. Floating-point values flip the
+ * sign bit when positive and every bit when negative, which orders them like
+ * numbers, with -0.0 before +0.0 and NaNs at the ends by their sign.
+ * @private
+ */
+static uint64_t radixKey(Type type, const void *val){
+    switch (type){
+        case INT8:   return (uint8_t)*(const int8_t *)val ^ 0x80u;
+        case INT16:  return (uint16_t)*(const int16_t *)val ^ 0x8000u;
+        case INT64:  return (uint64_t)*(const int64_t *)val ^ 0x8000000000000000u;
+        case UINT8:  return *(const uint8_t *)val;
+        case UINT16: return *(const uint16_t *)val;
+        case UINT32: return *(const uint32_t *)val;
+        case UINT64: return *(const uint64_t *)val;
+        case FLOAT: {
+            uint32_t bits;
+            memcpy(&bits, val, sizeof(bits));
+            return (bits & 0x80000000u) ? (uint32_t)~bits : bits ^ 0x80000000u;
+        }
+        case DOUBLE: {
+            uint64_t bits;
+            memcpy(&bits, val, sizeof(bits));
+            return (bits & 0x8000000000000000u) ? ~bits : bits ^ 0x8000000000000000u;
+        }
+        default:     return (uint32_t)*(const int32_t *)val ^ 0x80000000u;
+    }
+}
+
+/**
+ * @brief A node and its radix key, sorted in place of the node chain.
+ * @private
+ */
+struct RadixEntry{
+    uint64_t _key;  /**< The node's order-preserving key. */
+    Node _node;     /**< The node. */
+};
+
+/**
+ * @brief Counts, for every key byte, how many keys have each value of that byte.
+ * @private
+ */
+static void countBytes(size_t (*counts)[256], uint64_t key, int bytes){
+    for (int b = 0; b < bytes; b++){
+        counts[b][(key >> (8 * b)) & 0xFF]++;
+    }
+}
+
+/**
+ * @brief Turns the counts of one key byte into the first position of each bucket.
+ * @return false when every key has the same value of that byte and the pass can be skipped.
+ * @private
+ */
+static bool bucketStarts(size_t *count, size_t length){
+    size_t offset = 0;
+    for (int bucket = 0; bucket < 256; bucket++){
+        size_t c = count[bucket];
+        if (c == length) return false;
+        count[bucket] = offset;
+        offset += c;
+    }
+    return true;
+}
+
+/**
+ * @brief LSD radix sorts a node chain.
+ *
+ * The keys are computed once into an array of key/node pairs, which is
+ * radix sorted by one key byte per pass, stably; the nodes are then relinked
+ * in the sorted order. Walking the chain once instead of once per byte keeps
+ * the passes in cache.
+ * @private
+ */
+static Node radixNodes(ListHeader *this, Node head, Node *tail){
+    size_t length = (size_t)this->_length;
+    int bytes = keyBytes(this->_type);
+    struct RadixEntry *entries = allocate(this, 2 * length * sizeof(struct RadixEntry));
+    size_t (*counts)[256] = allocate(this, sizeof(size_t[8][256]));
+    if (entries == NULL || counts == NULL) {
+        fprintf(stderr, "Error in radixSort(): Failed to allocate the key array.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(counts, 0, sizeof(size_t[8][256]));
+    size_t n = 0;
+    for (Node current = head; current != NULL; current = current->_nextNode, n++){
+        entries[n]._key = radixKey(this->_type, current->_val);
+        entries[n]._node = current;
+        countBytes(counts, entries[n]._key, bytes);
+    }
+    struct RadixEntry *from = entries;
+    struct RadixEntry *to = entries + length;
+    for (int b = 0; b < bytes; b++){
+        if (!bucketStarts(counts[b], length)) continue;
+        for (size_t i = 0; i < length; i++){
+            to[counts[b][(from[i]._key >> (8 * b)) & 0xFF]++] = from[i];
+        }
+        struct RadixEntry *swap = from;
+        from = to;
+        to = swap;
+    }
+    for (size_t i = 0; i + 1 < length; i++){
+        from[i]._node->_nextNode = from[i + 1]._node;
+    }
+    from[length - 1]._node->_nextNode = NULL;
+    head = from[0]._node;
+    *tail = from[length - 1]._node;
+    deallocate(this, counts);
+    deallocate(this, entries);
+    return head;
+}
+
+/**
+ * @brief LSD radix sorts an array of numeric slots through a scratch buffer.
+ *
+ * One walk counts every key byte; each pass then scatters the slots by one
+ * byte, stably, between the array and the scratch buffer. A byte that is the
+ * same in every key is skipped.
+ * @private
+ */
+static void radixSlots(ListHeader *this, unsigned char *items, unsigned char *scratch, int length){
+    size_t size = this->_size;
+    int bytes = keyBytes(this->_type);
+    size_t (*counts)[256] = allocate(this, sizeof(size_t[8][256]));
+    if (counts == NULL) {
+        fprintf(stderr, "Error in radixSort(): Failed to allocate the byte counts.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(counts, 0, sizeof(size_t[8][256]));
+    for (int i = 0; i < length; i++){
+        countBytes(counts, radixKey(this->_type, items + (size_t)i * size), bytes);
+    }
+    unsigned char *from = items;
+    unsigned char *to = scratch;
+    for (int b = 0; b < bytes; b++){
+        if (!bucketStarts(counts[b], (size_t)length)) continue;
+        for (int i = 0; i < length; i++){
+            unsigned char *slot = from + (size_t)i * size;
+            size_t position = counts[b][(radixKey(this->_type, slot) >> (8 * b)) & 0xFF]++;
+            memcpy(to + position * size, slot, size);
+        }
+        unsigned char *swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from != items) memcpy(items, from, (size_t)length * size);
+    deallocate(this, counts);
+}
+
+/**
+ * @brief The sort functions generated for one element type.
+ * @private
+ */
+struct SortKit{
+    Node (*nodes)(Node head, Node *tail, int (*compare)(const void *, const void *));
+    Node (*mergeNodes)(Node a, Node b, int (*compare)(const void *, const void *));
+    void (*slots)(unsigned char *items, unsigned char *scratch, int length, size_t size,
+                  int (*compare)(const void *, const void *));
+    void (*mergeSlots)(const unsigned char *a, int na, const unsigned char *b, int nb,
+                       unsigned char *out, size_t size, int (*compare)(const void *, const void *));
+    int (*splitSlots)(const unsigned char *a, int na, const unsigned char *b, int nb,
+                      int k, size_t size, int (*compare)(const void *, const void *));
+};
+
+/** @private Lists the functions `NODE_SORT(node)` and `SLOT_SORT(slot)` defined. */
+#define SORT_KIT(node, slot) { node##Nodes, node##Merge, slot##Slots, slot##SlotMerge, slot##SlotSplit }
+
+/** @private */
+static const struct SortKit sortKits[] = {
+    SORT_KIT(sortInt, sortInt),
+    SORT_KIT(sortFloat, sortFloat),
+    SORT_KIT(sortDouble, sortDouble),
+    SORT_KIT(sortInt8, sortInt8),
+    SORT_KIT(sortInt16, sortInt16),
+    SORT_KIT(sortInt32, sortInt32),
+    SORT_KIT(sortInt64, sortInt64),
+    SORT_KIT(sortUint8, sortUint8),
+    SORT_KIT(sortUint16, sortUint16),
+    SORT_KIT(sortUint32, sortUint32),
+    SORT_KIT(sortUint64, sortUint64),
+    SORT_KIT(sortString, sortString),
+    SORT_KIT(sortUser, sortUserValue),
+    SORT_KIT(sortUser, sortUserPointer)
+};
+
+/**
+ * @brief Picks the sort functions for a list's type, or for its user comparator.
+ * @private
+ */
+static const struct SortKit *kitFor(ListHeader *this, const struct SortPlan *plan){
+    if (plan->compare != NULL) {
+        return &sortKits[this->_type == STRING || this->_type == T ? 13 : 12];
+    }
+    switch (this->_type){
+        case INT:    return &sortKits[0];
+        case FLOAT:  return &sortKits[1];
+        case DOUBLE: return &sortKits[2];
+        case INT8:   return &sortKits[3];
+        case INT16:  return &sortKits[4];
+        case INT32:  return &sortKits[5];
+        case INT64:  return &sortKits[6];
+        case UINT8:  return &sortKits[7];
+        case UINT16: return &sortKits[8];
+        case UINT32: return &sortKits[9];
+        case UINT64: return &sortKits[10];
+        default:     return &sortKits[11];
+    }
+}
+
+/**
+ * @brief Fewest elements each thread of a parallel sort is given.
+ *
+ * Below this, starting a thread costs more than sorting the elements.
+ * @private
+ */
+#define SORT_PARALLEL_GRAIN 16384
+
+/**
+ * @brief One piece of a parallel sort, run on its own thread.
+ *
+ * A task either sorts a chain (`_head`) or a slot range (`_a`, `_na`), or
+ * merges `_head` with `_other`, or `_a` with `_b`, into `_out`.
+ * @private
+ */
+struct SortTask{
+    const struct SortKit *_kit;                     /**< The sort functions. */
+    int (*_compare)(const void *, const void *);   /**< The user comparator, if any. */
+    void (*_work)(struct SortTask *task);           /**< What the task does. */
+    Node _head;                                     /**< The chain to sort, or the left chain to merge. */
+    Node _other;                                    /**< The right chain to merge. */
+    Node _tail;                                     /**< The last node of `_head`; after the task, of the result. */
+    Node _otherTail;                                /**< The last node of `_other`. */
+    const unsigned char *_a;                        /**< The slots to sort, or the left run to merge. */
+    const unsigned char *_b;                        /**< The right run to merge. */
+    unsigned char *_out;                            /**< Where merged slots go, or the scratch of a sort. */
+    int _na;                                        /**< Number of slots in `_a`. */
+    int _nb;                                        /**< Number of slots in `_b`. */
+    size_t _size;                                   /**< The slot size. */
+    pthread_t _thread;                              /**< The thread running the task. */
+    bool _started;                                  /**< Whether `_thread` was started. */
+};
+
+/** @private */
+static void sortChainTask(struct SortTask *task){
+    task->_head = task->_kit->nodes(task->_head, &task->_tail, task->_compare);
+}
+
+/** @private */
+static void mergeChainTask(struct SortTask *task){
+    Node leftTail = task->_tail;
+    task->_head = task->_kit->mergeNodes(task->_head, task->_other, task->_compare);
+    task->_tail = leftTail->_nextNode == NULL ? leftTail : task->_otherTail;
+}
+
+/** @private */
+static void sortSlotsTask(struct SortTask *task){
+    task->_kit->slots((unsigned char *)task->_a, task->_out, task->_na, task->_size, task->_compare);
+}
+
+/** @private */
+static void mergeSlotsTask(struct SortTask *task){
+    task->_kit->mergeSlots(task->_a, task->_na, task->_b, task->_nb, task->_out, task->_size, task->_compare);
+}
+
+/** @private */
+static void *runTask(void *task){
+    ((struct SortTask *)task)->_work(task);
+    return NULL;
+}
+
+/**
+ * @brief Runs `count` tasks at once: all but the last on new threads, the last on this one.
+ *
+ * A task whose thread cannot be started runs on this thread instead.
+ * @private
+ */
+static void runTasks(struct SortTask *tasks, int count){
+    for (int i = 0; i + 1 < count; i++){
+        tasks[i]._started = pthread_create(&tasks[i]._thread, NULL, runTask, &tasks[i]) == 0;
+    }
+    for (int i = 0; i < count; i++){
+        if (i + 1 == count || !tasks[i]._started) tasks[i]._work(&tasks[i]);
+    }
+    for (int i = 0; i + 1 < count; i++){
+        if (tasks[i]._started) pthread_join(tasks[i]._thread, NULL);
+    }
+}
+
+/**
+ * @brief Sorts a node chain on `threads` threads.
+ *
+ * The chain is cut into one run per thread and the runs are sorted at once;
+ * neighbouring runs are then merged pairwise, every merge of a round on its
+ * own thread, until one run is left. Merging neighbours, the left one first,
+ * keeps the result identical to the sequential sort.
+ * @private
+ */
+static Node parallelNodes(ListHeader *this, const struct SortKit *kit, Node head, Node *tail,
+                          const struct SortPlan *plan, int threads){
+    struct SortTask *tasks = allocate(this, (size_t)threads * sizeof(struct SortTask));
+    if (tasks == NULL) {
+        fprintf(stderr, "Error in parallelSort(): Failed to allocate the sort tasks.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(tasks, 0, (size_t)threads * sizeof(struct SortTask));
+    int per = this->_length / threads;
+    for (int t = 0; t < threads; t++){
+        tasks[t]._kit = kit;
+        tasks[t]._compare = plan->compare;
+        tasks[t]._work = sortChainTask;
+        tasks[t]._head = head;
+        if (t + 1 == threads) break;
+        for (int i = 1; i < per; i++){
+            head = head->_nextNode;
+        }
+        Node next = head->_nextNode;
+        head->_nextNode = NULL;
+        head = next;
+    }
+    runTasks(tasks, threads);
+
+    for (int runs = threads; runs > 1; runs = (runs + 1) / 2){
+        for (int p = 0; p < runs / 2; p++){
+            tasks[p]._head = tasks[2 * p]._head;
+            tasks[p]._tail = tasks[2 * p]._tail;
+            tasks[p]._other = tasks[2 * p + 1]._head;
+            tasks[p]._otherTail = tasks[2 * p + 1]._tail;
+            tasks[p]._work = mergeChainTask;
+        }
+        if (runs % 2 != 0) {
+            tasks[runs / 2]._head = tasks[runs - 1]._head;
+            tasks[runs / 2]._tail = tasks[runs - 1]._tail;
+        }
+        runTasks(tasks, runs / 2);
+    }
+    head = tasks[0]._head;
+    *tail = tasks[0]._tail;
+    deallocate(this, tasks);
+    return head;
+}
+
+/**
+ * @brief Sorts a slot array on `threads` threads.
+ *
+ * Each thread sorts its own range with its own part of the scratch buffer.
+ * The ranges are then merged pairwise, round after round, between the array
+ * and the scratch buffer. Each merge is cut into pieces of equal output
+ * size with `splitSlots`, so the last rounds, with few merges left, still keep
+ * every thread busy. Every piece takes its slots in the order the sequential
+ * merge would, so the result is the same.
+ * @private
+ */
+static void parallelSlots(ListHeader *this, const struct SortKit *kit, unsigned char *items,
+                          unsigned char *scratch, int length, const struct SortPlan *plan, int threads){
+    size_t size = this->_size;
+    struct SortTask *tasks = allocate(this, (size_t)threads * sizeof(struct SortTask));
+    int *bounds = allocate(this, (size_t)(threads + 1) * sizeof(int));
+    if (tasks == NULL || bounds == NULL) {
+        fprintf(stderr, "Error in parallelSort(): Failed to allocate the sort tasks.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(tasks, 0, (size_t)threads * sizeof(struct SortTask));
+    for (int t = 0; t <= threads; t++){
+        bounds[t] = (int)((long long)length * t / threads);
+    }
+    for (int t = 0; t < threads; t++){
+        tasks[t]._kit = kit;
+        tasks[t]._compare = plan->compare;
+        tasks[t]._size = size;
+        tasks[t]._work = sortSlotsTask;
+        tasks[t]._a = items + (size_t)bounds[t] * size;
+        tasks[t]._na = bounds[t + 1] - bounds[t];
+        tasks[t]._out = scratch + (size_t)bounds[t] * size;
+    }
+    runTasks(tasks, threads);
+
+    unsigned char *from = items;
+    unsigned char *to = scratch;
+    for (int runs = threads; runs > 1; runs = (runs + 1) / 2){
+        int merges = runs / 2;
+        int pieces = threads / merges;
+        int count = 0;
+        for (int p = 0; p < merges; p++){
+            const unsigned char *a = from + (size_t)bounds[2 * p] * size;
+            const unsigned char *b = from + (size_t)bounds[2 * p + 1] * size;
+            int na = bounds[2 * p + 1] - bounds[2 * p];
+            int nb = bounds[2 * p + 2] - bounds[2 * p + 1];
+            int i0 = 0;
+            for (int piece = 1; piece <= pieces; piece++){
+                int k = (int)((long long)(na + nb) * piece / pieces);
+                int i1 = kit->splitSlots(a, na, b, nb, k, size, plan->compare);
+                int k0 = (int)((long long)(na + nb) * (piece - 1) / pieces);
+                struct SortTask *task = &tasks[count++];
+                task->_work = mergeSlotsTask;
+                task->_a = a + (size_t)i0 * size;
+                task->_na = i1 - i0;
+                task->_b = b + (size_t)(k0 - i0) * size;
+                task->_nb = (k - i1) - (k0 - i0);
+                task->_out = to + (size_t)(bounds[2 * p] + k0) * size;
+                i0 = i1;
+            }
+        }
+        if (runs % 2 != 0) {
+            memcpy(to + (size_t)bounds[runs - 1] * size, from + (size_t)bounds[runs - 1] * size,
+                   (size_t)(bounds[runs] - bounds[runs - 1]) * size);
+        }
+        runTasks(tasks, count);
+        for (int p = 0; p <= (runs + 1) / 2; p++){
+            bounds[p] = bounds[2 * p < runs ? 2 * p : runs];
+        }
+        unsigned char *swap = from;
+        from = to;
+        to = swap;
+    }
+    if (from != items) memcpy(items, from, (size_t)length * size);
+    deallocate(this, bounds);
+    deallocate(this, tasks);
+}
+
+/**
+ * @brief Returns how many threads a parallel sort of `length` elements should use.
+ * @private
+ */
+static int threadsFor(const struct SortPlan *plan, int length){
+    int threads = length / SORT_PARALLEL_GRAIN;
+    return threads < plan->threads ? threads : plan->threads;
+}
+
+/** @copydoc sortNodes */
+Node sortNodes(ListHeader *this, Node head, Node *tail, const struct SortPlan *plan){
+    if (plan->radix) return radixNodes(this, head, tail);
+    const struct SortKit *kit = kitFor(this, plan);
+    int threads = threadsFor(plan, this->_length);
+    if (threads > 1) return parallelNodes(this, kit, head, tail, plan, threads);
+    return kit->nodes(head, tail, plan->compare);
+}
+
+/** @copydoc sortSlots */
+void sortSlots(ListHeader *this, unsigned char *items, int length, const struct SortPlan *plan){
+    if (length < 2) return;
+    unsigned char *scratch = allocate(this, (size_t)length * this->_size);
+    if (scratch == NULL) {
+        fprintf(stderr, "Error in sort(): Failed to allocate the merge buffer.\n");
+        exit(EXIT_FAILURE);
+    }
+    const struct SortKit *kit = kitFor(this, plan);
+    int threads = threadsFor(plan, length);
+    if (plan->radix) {
+        radixSlots(this, items, scratch, length);
+    } else if (threads > 1) {
+        parallelSlots(this, kit, items, scratch, length, plan, threads);
+    } else {
+        kit->slots(items, scratch, length, this->_size, plan->compare);
+    }
+    deallocate(this, scratch);
+}
+
+/** @copydoc sortGathered */
+void sortGathered(ListHeader *this, const struct SortPlan *plan,
+                  void (*move)(ListHeader *this, unsigned char *items, bool scatter)){
+    if (this->_length < 2) return;
+    unsigned char *items = allocate(this, (size_t)this->_length * this->_size);
+    if (items == NULL) {
+        fprintf(stderr, "Error in sort(): Failed to allocate the sort buffer.\n");
+        exit(EXIT_FAILURE);
+    }
+    move(this, items, false);
+    sortSlots(this, items, this->_length, plan);
+    move(this, items, true);
+    deallocate(this, items);
+}
+
+/**
+ * @brief Checks a sort request and runs it through the layout's `_sort`.
+ * @param this The list to sort.
+ * @param caller The public function to name in error messages.
+ * @param plan The comparator, algorithm and thread count.
+ * @private
+ */
+static void sortList(ListHeader *this, const char *caller, struct SortPlan plan){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (plan.threads < 1) {
+        fprintf(stderr, "Error in %s(): The thread count must be at least 1, not %d.\n", caller, plan.threads);
+        return;
+    }
+    if (plan.radix && (this->_type == T || this->_type == STRING || this->_type == RECORD)) {
+        fprintf(stderr, "Error in %s(): Only lists of a numeric type can be radix sorted.\n", caller);
+        return;
+    }
+    if (plan.compare == NULL && (this->_type == T || this->_type == RECORD)) {
+        fprintf(stderr, "Error in %s(): T and RECORD lists need a comparator.\n", caller);
+        return;
+    }
+    if (this->_length < 2) return;
+    this->_version++;
+    this->ops->_sort(this, &plan);
+}
+
+/** @copydoc sort */
+void sort(List list, int (*compare)(const void *, const void *)){
+    sortList(headerOf(list), "sort", (struct SortPlan){ compare, false, 1 });
+}
+
+/** @copydoc sortHeader */
+void sortHeader(ListHeader *header, int (*compare)(const void *, const void *)){
+    sortList(header, "sortHeader", (struct SortPlan){ compare, false, 1 });
+}
+
+/** @copydoc radixSort */
+void radixSort(List list){
+    sortList(headerOf(list), "radixSort", (struct SortPlan){ NULL, true, 1 });
+}
+
+/** @copydoc radixSortHeader */
+void radixSortHeader(ListHeader *header){
+    sortList(header, "radixSortHeader", (struct SortPlan){ NULL, true, 1 });
+}
+
+/** @copydoc parallelSort */
+void parallelSort(List list, int (*compare)(const void *, const void *), int threads){
+    sortList(headerOf(list), "parallelSort", (struct SortPlan){ compare, false, threads });
+}
+
+/** @copydoc parallelSortHeader */
+void parallelSortHeader(ListHeader *header, int (*compare)(const void *, const void *), int threads){
+    sortList(header, "parallelSortHeader", (struct SortPlan){ compare, false, threads });
+}
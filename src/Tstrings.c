@@ -0,0 +1,207 @@
+/**
+ * @file Tstrings.c
+ * @brief String storage for `STRING` lists: plain heap copies or a per-list arena.
+ *
+ * By default every string element is its own `malloc` block. After
+ * `enableStringArena`, strings are instead packed into the blocks of the list's
+ * `StringArena`, which are all released together by the list's `free` method.
+ * The arena and its settings live in the list's `ListExtras`.
+ * When interning is on, an open-addressing hash set maps each distinct string
+ * to its single copy in the arena.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Hashes a string with 64-bit FNV-1a.
+ * @private
+ */
+static size_t hashString(const char *str){
+    unsigned long long hash = 14695981039346656037ULL;
+    for (const unsigned char *c = (const unsigned char *)str; *c != '\0'; c++){
+        hash ^= *c;
+        hash *= 1099511628211ULL;
+    }
+    return (size_t)hash;
+}
+
+/**
+ * @brief Copies `length` bytes of a string into the arena.
+ *
+ * Blocks grow geometrically from `STRING_BLOCK_MIN` to `STRING_BLOCK_MAX`; a
+ * string larger than that gets a block of its own size.
+ * @private
+ */
+static char *arenaCopy(ListHeader *this, struct StringArena *arena, const char *str, size_t length){
+    struct StringBlock *block = arena->_blocks;
+    if (block == NULL || block->_capacity - arena->_used < length + 1) {
+        size_t capacity = block == NULL ? STRING_BLOCK_MIN : block->_capacity * 2;
+        if (capacity > STRING_BLOCK_MAX) capacity = STRING_BLOCK_MAX;
+        if (capacity < length + 1) capacity = length + 1;
+        struct StringBlock *fresh = allocate(this, sizeof(struct StringBlock) + capacity);
+        if (fresh == NULL) {
+            fprintf(stderr, "Error in copyString(): Failed to allocate a new string arena block.\n");
+            exit(EXIT_FAILURE);
+        }
+        fresh->_capacity = capacity;
+        fresh->_next = block;
+        arena->_blocks = fresh;
+        arena->_used = 0;
+        block = fresh;
+    }
+    char *copy = block->_bytes + arena->_used;
+    memcpy(copy, str, length + 1);
+    arena->_used += length + 1;
+    return copy;
+}
+
+/**
+ * @brief Doubles the intern set, rehashing its strings.
+ * @private
+ */
+static void growInterned(ListHeader *this, struct StringArena *arena){
+    size_t capacity = arena->_internCapacity == 0 ? 64 : arena->_internCapacity * 2;
+    char **buckets = allocate(this, capacity * sizeof(char *));
+    if (buckets == NULL) {
+        fprintf(stderr, "Error in copyString(): Failed to grow the string intern table.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(buckets, 0, capacity * sizeof(char *));
+    for (size_t i = 0; i < arena->_internCapacity; i++){
+        char *str = arena->_interned[i];
+        if (str == NULL) continue;
+        size_t j = hashString(str) & (capacity - 1);
+        while (buckets[j] != NULL) j = (j + 1) & (capacity - 1);
+        buckets[j] = str;
+    }
+    deallocate(this, arena->_interned);
+    arena->_interned = buckets;
+    arena->_internCapacity = capacity;
+}
+
+/**
+ * @brief Turns the string arena on for an empty `STRING` list.
+ * @private
+ */
+static void arenaStrings(ListHeader *this, const char *caller, bool intern){
+    if (this == NULL) {
+        fprintf(stderr, "Error in %s(): The provided list instance is NULL.\n", caller);
+        return;
+    }
+    if (this->_type != STRING) {
+        fprintf(stderr, "Error in %s(): The string arena is only available for STRING lists.\n", caller);
+        return;
+    }
+    if (this->_length != 0) {
+        fprintf(stderr, "Error in %s(): The string arena can only be enabled on an empty list.\n", caller);
+        return;
+    }
+    struct ListExtras *extras = ownExtras(this);
+    extras->_stringArena = true;
+    extras->_intern = intern;
+}
+
+/** @copydoc enableStringArena */
+void enableStringArena(List list, bool intern){
+    arenaStrings(headerOf(list), "enableStringArena", intern);
+}
+
+/** @copydoc enableStringArenaHeader */
+void enableStringArenaHeader(ListHeader *header, bool intern){
+    arenaStrings(header, "enableStringArenaHeader", intern);
+}
+
+/**
+ * @brief Makes a list-owned copy of a string.
+ *
+ * Without a string arena this is a plain heap copy. With one, the string is
+ * packed into the arena, or, when interning, the existing arena copy of an
+ * equal string is returned.
+ * @param this A pointer to the list.
+ * @param str The string to copy. Must not be NULL.
+ * @return The list-owned copy of `str`.
+ * @private
+ */
+char *copyString(ListHeader *this, const char *str){
+    size_t length = strlen(str);
+    struct ListExtras *extras = this->_extras;
+    if (!extras->_stringArena) {
+        char *copy = allocate(this, length + 1);
+        if (copy == NULL) {
+            fprintf(stderr, "Error in copyString(): Failed to allocate memory for the string value.\n");
+            exit(EXIT_FAILURE);
+        }
+        return memcpy(copy, str, length + 1);
+    }
+    struct StringArena *arena = extras->_strings;
+    if (arena == NULL) {
+        arena = allocate(this, sizeof(struct StringArena));
+        if (arena == NULL) {
+            fprintf(stderr, "Error in copyString(): Failed to allocate the string arena.\n");
+            exit(EXIT_FAILURE);
+        }
+        memset(arena, 0, sizeof(struct StringArena));
+        extras->_strings = arena;
+    }
+    if (!extras->_intern) {
+        return arenaCopy(this, arena, str, length);
+    }
+
+    if ((arena->_internCount + 1) * 2 > arena->_internCapacity) growInterned(this, arena);
+    size_t mask = arena->_internCapacity - 1;
+    size_t i = hashString(str) & mask;
+    while (arena->_interned[i] != NULL){
+        if (strcmp(arena->_interned[i], str) == 0) return arena->_interned[i];
+        i = (i + 1) & mask;
+    }
+    arena->_interned[i] = arenaCopy(this, arena, str, length);
+    arena->_internCount++;
+    return arena->_interned[i];
+}
+
+/**
+ * @brief Tells whether the list's strings are plain `malloc` blocks.
+ *
+ * Only then can `pop` and `pick` hand a string to the caller without copying it:
+ * strings in a string arena, a `ListArena` or from a `ListAllocator` are not
+ * valid arguments to `free()`.
+ * @param this A pointer to the list.
+ * @private
+ */
+bool mallocStrings(ListHeader *this){
+    const struct ListExtras *extras = this->_extras;
+    return !extras->_stringArena && extras->_arena == NULL && extras->_allocator == NULL;
+}
+
+/**
+ * @brief Releases a string obtained from `copyString`.
+ *
+ * Arena strings stay in the arena until the list is freed.
+ * @param this A pointer to the list.
+ * @param str The string to release.
+ * @private
+ */
+void releaseString(ListHeader *this, char *str){
+    if (!this->_extras->_stringArena) deallocate(this, str);
+}
+
+/**
+ * @brief Frees the string arena: every block and the intern set.
+ *
+ * Called through `releaseExtras`, which then turns the arena off.
+ * @param this A pointer to the list.
+ * @private
+ */
+void releaseStrings(ListHeader *this){
+    struct StringArena *arena = this->_extras->_strings;
+    if (arena == NULL) return;
+    while (arena->_blocks != NULL){
+        struct StringBlock *block = arena->_blocks;
+        arena->_blocks = block->_next;
+        deallocate(this, block);
+    }
+    deallocate(this, arena->_interned);
+    deallocate(this, arena);
+    this->_extras->_strings = NULL;
+}
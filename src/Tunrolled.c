@@ -0,0 +1,547 @@
+/**
+ * @file Tunrolled.c
+ * @brief Implementation of the `UNROLLED` list layout.
+ *
+ * An unrolled list is a singly linked list of chunks, where each chunk holds up
+ * to `_chunkCapacity` elements in a contiguous array. Sequential access touches
+ * one cache line for several elements, while insertion and removal only shift
+ * the elements of a single chunk. A full chunk is split in two on insertion, and
+ * a chunk that drops below half capacity is merged with its successor when the
+ * two fit together.
+ */
+
+#include "Tlist.h"
+#include "TlistPrivate.h"
+
+/**
+ * @brief Returns the address of slot `i` of a chunk.
+ * @private
+ */
+static unsigned char *slotAt(ListHeader *this, struct Chunk *chunk, int i){
+    return chunk->_items + (size_t)i * this->_size;
+}
+
+/**
+ * @brief Allocates an empty chunk.
+ * @private
+ */
+static struct Chunk *newChunk(ListHeader *this){
+    struct Chunk *chunk = allocate(this, sizeof(struct Chunk) + (size_t)this->_chunkCapacity * this->_size);
+    if (chunk == NULL) {
+        fprintf(stderr, "Error in newChunk(): Failed to allocate memory for a new chunk.\n");
+        exit(EXIT_FAILURE);
+    }
+    chunk->_next = NULL;
+    chunk->_count = 0;
+    return chunk;
+}
+
+/**
+ * @brief Finds the chunk holding the element at `index`.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element. Must be in bounds.
+ * @param prev Receives the chunk before the returned one, or NULL for the first chunk.
+ * @param offset Receives the position of the element inside the returned chunk.
+ * @return The chunk holding the element.
+ * @private
+ */
+static struct Chunk *locate(ListHeader *this, int index, struct Chunk **prev, int *offset){
+    struct Chunk *before = NULL;
+    struct Chunk *chunk = this->_firstChunk;
+    while (index >= chunk->_count){
+        index -= chunk->_count;
+        before = chunk;
+        chunk = chunk->_next;
+    }
+    if (prev != NULL) *prev = before;
+    *offset = index;
+    return chunk;
+}
+
+/**
+ * @brief Appends a value after the last element.
+ * @private
+ */
+static void appendValue(ListHeader *this, void *val){
+    struct Chunk *last = this->_lastChunk;
+    if (last == NULL || last->_count == this->_chunkCapacity) {
+        struct Chunk *chunk = newChunk(this);
+        if (last == NULL) {
+            this->_firstChunk = chunk;
+        } else {
+            last->_next = chunk;
+        }
+        this->_lastChunk = chunk;
+        last = chunk;
+    }
+    storeValue(this, slotAt(this, last, last->_count), val);
+    last->_count++;
+    this->_length++;
+}
+
+/**
+ * @brief Appends `n` values from an array, filling each chunk with one copy.
+ * @param this A pointer to the list.
+ * @param src The values, in slot format.
+ * @param n Number of values.
+ * @private
+ */
+void unrolledPushValues(ListHeader *this, const unsigned char *src, size_t n){
+    while (n > 0){
+        struct Chunk *last = this->_lastChunk;
+        if (last == NULL || last->_count == this->_chunkCapacity) {
+            struct Chunk *chunk = newChunk(this);
+            if (last == NULL) {
+                this->_firstChunk = chunk;
+            } else {
+                last->_next = chunk;
+            }
+            this->_lastChunk = chunk;
+            last = chunk;
+        }
+        size_t take = (size_t)(this->_chunkCapacity - last->_count);
+        if (take > n) take = n;
+        if (this->_type == STRING) {
+            for (size_t i = 0; i < take; i++){
+                storeValue(this, slotAt(this, last, last->_count + (int)i), slotValue(this, (unsigned char *)src + i * this->_size));
+            }
+        } else {
+            memcpy(slotAt(this, last, last->_count), src, take * this->_size);
+        }
+        last->_count += (int)take;
+        this->_length += (int)take;
+        src += take * this->_size;
+        n -= take;
+    }
+}
+
+/**
+ * @brief Removes the slot at `offset` from `chunk`, without releasing its value.
+ *
+ * Frees the chunk if it becomes empty, or merges its successor into it when
+ * it drops below half capacity and both fit in one chunk.
+ * @private
+ */
+static void removeSlot(ListHeader *this, struct Chunk *prev, struct Chunk *chunk, int offset){
+    memmove(slotAt(this, chunk, offset), slotAt(this, chunk, offset + 1),
+            (size_t)(chunk->_count - offset - 1) * this->_size);
+    chunk->_count--;
+    this->_length--;
+
+    if (chunk->_count == 0) {
+        if (prev == NULL) {
+            this->_firstChunk = chunk->_next;
+        } else {
+            prev->_next = chunk->_next;
+        }
+        if (this->_lastChunk == chunk) {
+            this->_lastChunk = prev;
+        }
+        deallocate(this, chunk);
+        return;
+    }
+
+    struct Chunk *next = chunk->_next;
+    if (next != NULL && chunk->_count < this->_chunkCapacity / 2
+        && chunk->_count + next->_count <= this->_chunkCapacity) {
+        memcpy(slotAt(this, chunk, chunk->_count), next->_items, (size_t)next->_count * this->_size);
+        chunk->_count += next->_count;
+        chunk->_next = next->_next;
+        if (this->_lastChunk == next) {
+            this->_lastChunk = chunk;
+        }
+        deallocate(this, next);
+    }
+}
+
+/**
+ * @brief Prints the contents of the list to standard output.
+ * @param this A pointer to the list.
+ * @private
+ */
+void unrolledPrint(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in print(): The provided list instance is NULL.\n");
+        return;
+    }
+    printf("[");
+    for (struct Chunk *chunk = this->_firstChunk; chunk != NULL; chunk = chunk->_next){
+        for (int i = 0; i < chunk->_count; i++){
+            printValue(this, slotValue(this, slotAt(this, chunk, i)));
+            if (i + 1 < chunk->_count || chunk->_next != NULL){
+                printf(", ");
+            }
+        }
+    }
+    printf("]");
+    printf("\n");
+}
+
+/**
+ * @brief Frees all chunks and the strings they own.
+ *
+ * As with the `LINKED` layout, pointers stored in a `T` list are not freed.
+ * This function does NOT free the `List` struct itself.
+ * @param this A pointer to the list.
+ * @private
+ */
+void unrolledDestroy(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in destroyList(): The provided list instance is NULL.\n");
+        return;
+    }
+    struct Chunk *chunk = this->_firstChunk;
+    while (chunk != NULL){
+        struct Chunk *temp = chunk;
+        chunk = temp->_next;
+        if (this->_type == STRING && !this->_extras->_stringArena) {
+            for (int i = 0; i < temp->_count; i++){
+                releaseSlot(this, slotAt(this, temp, i));
+            }
+        }
+        deallocate(this, temp);
+    }
+    releaseExtras(this);
+    this->_firstChunk = NULL;
+    this->_lastChunk = NULL;
+    this->_length = 0;
+}
+
+/**
+ * @brief Adds a new element to the end of the list.
+ * @param this A pointer to the list.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void unrolledPushValue(ListHeader *this, void *val){
+    appendValue(this, val);
+}
+
+/**
+ * @brief Removes the first element of the list and returns its value.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * @param this A pointer to the list.
+ * @return A pointer to the value of the removed element, or `NULL` if the list is empty.
+ * @private
+ */
+void *unrolledPop(ListHeader *this){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pop(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (this->_firstChunk == NULL) {
+        return NULL;
+    }
+    void *val = takeSlot(this, slotAt(this, this->_firstChunk, 0));
+    removeSlot(this, NULL, this->_firstChunk, 0);
+    return val;
+}
+
+/**
+ * @brief Retrieves a pointer to the element at a specific index.
+ *
+ * Skips whole chunks by their element count, then indexes into the chunk.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to retrieve.
+ * @return A pointer to the element's value, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *unrolledGet(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in get(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in get(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in get(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    int offset;
+    struct Chunk *chunk = locate(this, index, NULL, &offset);
+    return slotValue(this, slotAt(this, chunk, offset));
+}
+
+/**
+ * @brief Updates the value of an element at a specific index.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to update.
+ * @param val A pointer to the new value, as read by `readValue`.
+ * @private
+ */
+void unrolledSetValue(ListHeader *this, int index, void *val){
+    if (index < 0) {
+        fprintf(stderr, "Error in set(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in set(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    int offset;
+    struct Chunk *chunk = locate(this, index, NULL, &offset);
+    unsigned char *slot = slotAt(this, chunk, offset);
+    releaseSlot(this, slot);
+    storeValue(this, slot, val);
+}
+
+/**
+ * @brief Deletes the element at a specific index, freeing the string it owns.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to delete.
+ * @private
+ */
+void unrolledDelete(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in delete(): The provided list instance is NULL.\n");
+        return;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in delete(): Index %d is negative and invalid.\n", index);
+        return;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in delete(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return;
+    }
+    struct Chunk *prev;
+    int offset;
+    struct Chunk *chunk = locate(this, index, &prev, &offset);
+    releaseSlot(this, slotAt(this, chunk, offset));
+    removeSlot(this, prev, chunk, offset);
+}
+
+/**
+ * @brief Inserts a new element at a specific index.
+ *
+ * When the target chunk is full, its upper half is moved to a new chunk first.
+ * @param this A pointer to the list.
+ * @param index The zero-based index at which to insert the new element.
+ * @param val A pointer to the value, as read by `readValue`.
+ * @private
+ */
+void unrolledInsertValue(ListHeader *this, int index, void *val){
+    if (index < 0 || index > this->_length) {
+        fprintf(stderr, "Error in insert(): Index %d is out of bounds. Valid range is 0 to %d.\n", index, this->_length);
+        return;
+    }
+    if (index == this->_length) {
+        appendValue(this, val);
+        return;
+    }
+
+    int offset;
+    struct Chunk *chunk = locate(this, index, NULL, &offset);
+    if (chunk->_count == this->_chunkCapacity) {
+        struct Chunk *half = newChunk(this);
+        int keep = chunk->_count / 2;
+        half->_count = chunk->_count - keep;
+        memcpy(half->_items, slotAt(this, chunk, keep), (size_t)half->_count * this->_size);
+        chunk->_count = keep;
+        half->_next = chunk->_next;
+        chunk->_next = half;
+        if (this->_lastChunk == chunk) {
+            this->_lastChunk = half;
+        }
+        if (offset > keep) {
+            chunk = half;
+            offset -= keep;
+        }
+    }
+    memmove(slotAt(this, chunk, offset + 1), slotAt(this, chunk, offset),
+            (size_t)(chunk->_count - offset) * this->_size);
+    storeValue(this, slotAt(this, chunk, offset), val);
+    chunk->_count++;
+    this->_length++;
+}
+
+/**
+ * @brief Removes and returns the element at a specific index.
+ *
+ * The caller takes ownership of the returned pointer, exactly as with the `LINKED` layout.
+ * An element of the last chunk is reached without walking the chunks, so
+ * `popBack` only walks when it empties the last chunk.
+ * @param this A pointer to the list.
+ * @param index The zero-based index of the element to remove.
+ * @return A pointer to the value of the removed element, or `NULL` if the index is out of bounds.
+ * @private
+ */
+void *unrolledPick(ListHeader *this, int index){
+    if (this == NULL) {
+        fprintf(stderr, "Error in pick(): The provided list instance is NULL.\n");
+        return NULL;
+    }
+    if (index < 0) {
+        fprintf(stderr, "Error in pick(): Index %d is negative and invalid.\n", index);
+        return NULL;
+    }
+    if (index >= this->_length) {
+        fprintf(stderr, "Error in pick(): Index %d is out of bounds for list of size %d.\n", index, this->_length);
+        return NULL;
+    }
+    struct Chunk *prev = NULL;
+    struct Chunk *chunk = this->_lastChunk;
+    int offset = index - (this->_length - chunk->_count);
+    if (offset < 0 || chunk->_count == 1) {
+        chunk = locate(this, index, &prev, &offset);
+    }
+    void *val = takeSlot(this, slotAt(this, chunk, offset));
+    removeSlot(this, prev, chunk, offset);
+    return val;
+}
+
+/**
+ * @brief Applies a given function to each element in the list.
+ * @param this A pointer to the list.
+ * @param function A function pointer that takes a `void*` (the element's data) and returns `void`.
+ * @private
+ */
+void unrolledForeach(ListHeader *this, void(*function)(void*)){
+    if (this == NULL) {
+        fprintf(stderr, "Error in foreach(): The provided list instance is NULL.\n");
+        return;
+    }
+    for (struct Chunk *chunk = this->_firstChunk; chunk != NULL; chunk = chunk->_next){
+        unsigned char *slot = chunk->_items;
+        for (int i = 0; i < chunk->_count; i++, slot += this->_size){
+            function(slotValue(this, slot));
+        }
+    }
+}
+
+/**
+ * @brief Returns the next element of an `UNROLLED` list iteration.
+ * @param iterator A pointer to the iterator.
+ * @return A pointer to the next element's value, or `NULL` if the end is reached or the iterator is invalid.
+ * @private
+ */
+void *unrolledNext(TIterator iterator){
+    if (iterator == NULL || iterator->_chunk == NULL) {
+        fprintf(stderr, "Error in next(): No more elements to iterate or invalid iterator.\n");
+        return NULL;
+    }
+    ListHeader *list = iterator->_list;
+    void *val = slotValue(list, slotAt(list, iterator->_chunk, iterator->_slot));
+    iterator->_index++;
+    if (++iterator->_slot == iterator->_chunk->_count) {
+        iterator->_chunk = iterator->_chunk->_next;
+        iterator->_slot = 0;
+    }
+    return val;
+}
+
+/**
+ * @brief Checks if an `UNROLLED` list iteration has more elements.
+ * @param iterator A pointer to the iterator.
+ * @return `true` if there is at least one more element to iterate over, `false` otherwise.
+ * @private
+ */
+bool unrolledHasNext(TIterator iterator){
+    if (iterator == NULL) {
+        return false;
+    }
+    return iterator->_chunk != NULL;
+}
+
+/**
+ * @brief Appends the chunks of `src` in O(1).
+ * @private
+ */
+void unrolledConcat(ListHeader *this, ListHeader *src){
+    if (src->_firstChunk == NULL) return;
+    if (this->_lastChunk == NULL) {
+        this->_firstChunk = src->_firstChunk;
+    } else {
+        this->_lastChunk->_next = src->_firstChunk;
+    }
+    this->_lastChunk = src->_lastChunk;
+    this->_length += src->_length;
+    src->_firstChunk = NULL;
+    src->_lastChunk = NULL;
+    src->_length = 0;
+}
+
+/**
+ * @brief Detaches the elements from `index` onwards into `suffix`.
+ *
+ * The chunks after the one holding `index` are relinked; that chunk is split
+ * in two when `index` falls inside it. `index` is strictly between 0 and the length.
+ * @private
+ */
+void unrolledSplitAt(ListHeader *this, int index, ListHeader *suffix){
+    struct Chunk *prev;
+    int offset;
+    struct Chunk *chunk = locate(this, index, &prev, &offset);
+    if (offset == 0) {
+        prev->_next = NULL;
+        suffix->_firstChunk = chunk;
+        suffix->_lastChunk = this->_lastChunk;
+        this->_lastChunk = prev;
+    } else {
+        struct Chunk *fresh = newChunk(suffix);
+        fresh->_count = chunk->_count - offset;
+        memcpy(fresh->_items, slotAt(this, chunk, offset), (size_t)fresh->_count * this->_size);
+        chunk->_count = offset;
+        fresh->_next = chunk->_next;
+        chunk->_next = NULL;
+        suffix->_firstChunk = fresh;
+        suffix->_lastChunk = chunk == this->_lastChunk ? fresh : this->_lastChunk;
+        this->_lastChunk = chunk;
+    }
+    suffix->_length = this->_length - index;
+    this->_length = index;
+}
+
+/**
+ * @brief Copies the slots of every chunk to or from a contiguous array.
+ * @private
+ */
+static void moveSlots(ListHeader *this, unsigned char *items, bool scatter){
+    for (struct Chunk *chunk = this->_firstChunk; chunk != NULL; chunk = chunk->_next){
+        size_t bytes = (size_t)chunk->_count * this->_size;
+        if (scatter) {
+            memcpy(chunk->_items, items, bytes);
+        } else {
+            memcpy(items, chunk->_items, bytes);
+        }
+        items += bytes;
+    }
+}
+
+/**
+ * @brief Sorts the list, moving the values between the chunks' slots.
+ * @private
+ */
+void unrolledSort(ListHeader *this, const struct SortPlan *plan){
+    sortGathered(this, plan, moveSlots);
+}
+
+/**
+ * @brief Searches the chunks in order, one slot array at a time.
+ * @private
+ */
+int unrolledFind(ListHeader *this, const struct SearchPlan *plan){
+    int found = plan->mode == FIND_COUNT ? 0 : -1;
+    int base = 0;
+    for (struct Chunk *chunk = this->_firstChunk; chunk != NULL; chunk = chunk->_next){
+        int result = searchSlots(this, chunk->_items, chunk->_count, plan);
+        if (plan->mode == FIND_COUNT) {
+            found += result;
+        } else if (result >= 0) {
+            found = base + result;
+            if (plan->mode != FIND_LAST) break;
+        }
+        base += chunk->_count;
+    }
+    return found;
+}
+
+/** @private */
+const struct ListOps unrolledOps = {
+    push, unrolledPop, unrolledPrint, len, unrolledDestroy, unrolledGet, set, unrolledDelete, insert, unrolledPick, unrolledForeach,
+    popBack, unrolledPushValue, unrolledSetValue, unrolledInsertValue, unrolledPushValues,
+    unrolledConcat, unrolledSplitAt, unrolledSort, unrolledFind
+};